@@ -0,0 +1,479 @@
+#include "Settings.h"
+#include "Camera.h"
+#include "Matrix.h"
+#include "Vector.h"
+#include "Scene.h"
+#include "Renderer.h"
+#include "Tools.h"
+#include "Mesh.h"
+#include "Raster.h"
+
+/// @brief Nombre maximal de vues côte à côte.
+#define HEADLESS_MAX_VIEWS 16
+
+/// @brief Paramètres du rendu hors écran, lus sur la ligne de commande.
+typedef struct HeadlessOptions_s
+{
+    char *folder;
+    char *fileName;
+    const char *output;
+    int width;
+    int height;
+    int frameCount;
+    int viewCount;
+    float camDistance;
+    float targetTime;
+    int shadingMode;
+    int watertightViews;
+    bool orbit;
+    bool msaa;
+    bool hdr;
+    bool reversedZ;
+    bool wireframe;
+} HeadlessOptions;
+
+static void Headless_PrintUsage(const char *program)
+{
+    printf("Usage : %s <dossier> <fichier.obj> [options]\n", program);
+    printf("  -w <largeur>     largeur de l'image (1920)\n");
+    printf("  -h <hauteur>     hauteur de l'image (1080)\n");
+    printf("  -n <images>      nombre d'images rendues (1)\n");
+    printf("  -o <fichier>     image de sortie .png ou .ppm ; un motif printf\n");
+    printf("                   (par exemple frame_%%04d.png) enregistre chaque image\n");
+    printf("  -d <distance>    distance de la caméra (7.3)\n");
+    printf("  -target <ms>     résolution dynamique visant une durée de rendu par image\n");
+    printf("  -vrs <mode>      ombrage à taux variable : 0 aucun, 1 selon le contenu, 2 fovéal\n");
+    printf("  -views <n>       rend n vues côte à côte autour de l'objet (1 à %d)\n",
+        HEADLESS_MAX_VIEWS);
+    printf("  -orbit           fait tourner la caméra autour de l'objet sur les images\n");
+    printf("  -msaa            active l'anticrénelage (MSAA)\n");
+    printf("  -hdr             active le rendu HDR\n");
+    printf("  -reversedz       utilise un buffer de profondeur flottant inversé\n");
+    printf("  -wireframe       affiche les arêtes des triangles\n");
+    printf("  -watertight <n>  vérifie l'étanchéité de la rastérisation du mesh (fermé)\n");
+    printf("                   sur n vues aléatoires, sans rendu ; échoue en cas d'erreur\n");
+}
+
+static int Headless_ParseOptions(HeadlessOptions *options, int argc, char *argv[])
+{
+    if (argc < 3) goto ERROR_LABEL;
+
+    options->folder = argv[1];
+    options->fileName = argv[2];
+    options->output = NULL;
+    options->width = 1920;
+    options->height = 1080;
+    options->frameCount = 1;
+    options->viewCount = 1;
+    options->camDistance = 7.3f;
+    options->targetTime = 0.0f;
+    options->shadingMode = RENDERER_SHADING_FULL;
+    options->watertightViews = 0;
+    options->orbit = false;
+    options->msaa = false;
+    options->hdr = false;
+    options->reversedZ = false;
+    options->wireframe = false;
+
+    for (int i = 3; i < argc; ++i)
+    {
+        const char *arg = argv[i];
+        const char *value = (i + 1 < argc) ? argv[i + 1] : NULL;
+
+        if (strcmp(arg, "-orbit") == 0) options->orbit = true;
+        else if (strcmp(arg, "-msaa") == 0) options->msaa = true;
+        else if (strcmp(arg, "-hdr") == 0) options->hdr = true;
+        else if (strcmp(arg, "-reversedz") == 0) options->reversedZ = true;
+        else if (strcmp(arg, "-wireframe") == 0) options->wireframe = true;
+        else if (!value) goto ERROR_LABEL;
+        else
+        {
+            if (strcmp(arg, "-w") == 0) options->width = atoi(value);
+            else if (strcmp(arg, "-h") == 0) options->height = atoi(value);
+            else if (strcmp(arg, "-n") == 0) options->frameCount = atoi(value);
+            else if (strcmp(arg, "-views") == 0) options->viewCount = atoi(value);
+            else if (strcmp(arg, "-d") == 0) options->camDistance = (float)atof(value);
+            else if (strcmp(arg, "-target") == 0) options->targetTime = (float)atof(value);
+            else if (strcmp(arg, "-vrs") == 0) options->shadingMode = atoi(value);
+            else if (strcmp(arg, "-watertight") == 0) options->watertightViews = atoi(value);
+            else if (strcmp(arg, "-o") == 0) options->output = value;
+            else goto ERROR_LABEL;
+            i++;
+        }
+    }
+
+    if (options->width <= 0 || options->height <= 0 || options->frameCount <= 0)
+        goto ERROR_LABEL;
+    if (options->width > RASTER_MAX_COORD || options->height > RASTER_MAX_COORD)
+        goto ERROR_LABEL;
+    if (options->targetTime < 0.0f || options->watertightViews < 0)
+        goto ERROR_LABEL;
+    if (options->shadingMode < 0 || options->shadingMode >= RENDERER_SHADING_MODE_COUNT)
+        goto ERROR_LABEL;
+    if (options->viewCount <= 0 || options->viewCount > HEADLESS_MAX_VIEWS ||
+        options->viewCount > options->width)
+        goto ERROR_LABEL;
+
+    return EXIT_SUCCESS;
+
+ERROR_LABEL:
+    Headless_PrintUsage(argv[0]);
+    return EXIT_FAILURE;
+}
+
+/// @brief Enregistre l'image rendue selon l'extension du fichier (.png ou .ppm).
+static int Headless_SaveFrame(Renderer *renderer, const char *output, int frame)
+{
+    char path[1024] = { 0 };
+
+    // Motif printf : une image par numéro, sinon le fichier est réécrit
+    if (strchr(output, '%'))
+        snprintf(path, sizeof(path), output, frame);
+    else
+        snprintf(path, sizeof(path), "%s", output);
+
+    const char *extension = strrchr(path, '.');
+    if (extension && (strcmp(extension, ".png") == 0 || strcmp(extension, ".PNG") == 0))
+        return Renderer_SavePNG(renderer, path);
+    else
+        return Renderer_SavePPM(renderer, path);
+}
+
+/// @brief Générateur congruentiel linéaire : les mêmes vues sur toutes les plateformes.
+/// @return Un nombre aléatoire dans [0, 1).
+static float Headless_Random(unsigned *seed)
+{
+    *seed = *seed * 1664525u + 1013904223u;
+    return (float)(*seed >> 8) / (float)(1u << 24);
+}
+
+/// @brief Ajoute 1 au compteur de chaque pixel couvert par un triangle.
+/// Les groupes de pixels sont évalués par le noyau de rastérisation.
+static void Headless_CountCoverage(const RasterTriangle *tri, int width, int height, int *counts)
+{
+    float zValues[RASTER_LANES];
+    int x0 = tri->xmin - tri->xmin % RASTER_GROUP_WIDTH;
+    int y0 = tri->ymin - tri->ymin % RASTER_GROUP_HEIGHT;
+
+    for (int y = y0; y <= tri->ymax; y += RASTER_GROUP_HEIGHT)
+    {
+        for (int x = x0; x <= tri->xmax; x += RASTER_GROUP_WIDTH)
+        {
+            unsigned laneMask = 0;
+            for (int k = 0; k < RASTER_LANES; ++k)
+            {
+                int px = x + RASTER_LANE_X(k);
+                int py = y + RASTER_LANE_Y(k);
+                if (px < width && py < height)
+                    laneMask |= 1u << k;
+            }
+
+            unsigned covered = 0;
+            RasterTriangle_EvalGroup(tri, x, y, laneMask, true, NULL, zValues, &covered);
+            for (int k = 0; k < RASTER_LANES; ++k)
+            {
+                if (covered & (1u << k))
+                    counts[(y + RASTER_LANE_Y(k)) * width + x + RASTER_LANE_X(k)]++;
+            }
+        }
+    }
+}
+
+/// @brief Vérifie l'étanchéité de la rastérisation d'un mesh fermé.
+/// Pour chaque vue aléatoire, les triangles de face et les triangles de dos
+/// (rastérisés avec l'ordre de leurs sommets inversé) sont comptés par pixel :
+/// tout rayon entre dans le mesh autant de fois qu'il en sort, les deux nombres
+/// sont donc égaux, sauf si un pixel est couvert deux fois ou oublié le long
+/// d'une arête partagée. En MSAA, chaque échantillon est vérifié.
+/// @return EXIT_SUCCESS si aucun pixel n'est incohérent, EXIT_FAILURE sinon.
+static int Headless_CheckWatertight(Mesh *mesh, HeadlessOptions *options)
+{
+    int width = options->width;
+    int height = options->height;
+    int samples = options->msaa ? RASTER_MSAA_SAMPLES : 1;
+    int *front = (int *)calloc((size_t)width * height, sizeof(int));
+    int *back = (int *)calloc((size_t)width * height, sizeof(int));
+    Vec3 *projected = (Vec3 *)calloc(mesh->m_vertexCount, sizeof(Vec3));
+    long long coveredPixels = 0;
+    long long mismatches = 0;
+
+    if (!front || !back || !projected) goto ERROR_LABEL;
+
+    unsigned seed = 1234;
+    float radius = 0.5f * fmaxf(
+        mesh->m_max.x - mesh->m_min.x, fmaxf(
+        mesh->m_max.y - mesh->m_min.y, mesh->m_max.z - mesh->m_min.z));
+    float minSize = (float)Int_Min(width, height);
+
+    for (int view = 0; view < options->watertightViews; ++view)
+    {
+        // Rotation, taille et position aléatoires, projection perspective
+        float angleX = 360.0f * Headless_Random(&seed);
+        float angleY = 360.0f * Headless_Random(&seed);
+        float scale = minSize * (0.1f + 0.9f * Headless_Random(&seed));
+        float centerX = width * (0.25f + 0.5f * Headless_Random(&seed));
+        float centerY = height * (0.25f + 0.5f * Headless_Random(&seed));
+        Mat4 rotation = Mat4_MulMM(
+            Mat4_GetXRotationMatrix(angleX), Mat4_GetYRotationMatrix(angleY));
+
+        for (int i = 0; i < mesh->m_vertexCount; ++i)
+        {
+            Vec3 position = Vec3_Scale(Vec3_Sub(mesh->m_vertices[i], mesh->m_center), 1.0f / radius);
+            Vec4 rotated = Mat4_MulMV(rotation, Vec4_From3(position, 1.0f));
+            float w = 4.0f - rotated.z;
+            projected[i] = Vec3_Set(
+                centerX + scale * rotated.x / w,
+                centerY + scale * rotated.y / w,
+                0.5f);
+        }
+
+        // En MSAA, chaque échantillon est vérifié séparément
+        for (int sample = 0; sample < samples; ++sample)
+        {
+            memset(front, 0, (size_t)width * height * sizeof(int));
+            memset(back, 0, (size_t)width * height * sizeof(int));
+
+            for (int t = 0; t < mesh->m_triangleCount; ++t)
+            {
+                int *indices = mesh->m_triangles[t].m_vertexIndices;
+                Vec3 vertices[2][3] = {
+                    { projected[indices[0]], projected[indices[1]], projected[indices[2]] },
+                    { projected[indices[0]], projected[indices[2]], projected[indices[1]] },
+                };
+
+                // Un seul des deux ordres donne un triangle de face
+                for (int side = 0; side < 2; ++side)
+                {
+                    RasterTriangle tri;
+                    if (!RasterTriangle_Setup(
+                        &tri, vertices[side], 0, 0, width - 1, height - 1, samples))
+                        continue;
+
+                    RasterTriangle sampleTri = tri;
+                    if (samples > 1)
+                        RasterTriangle_GetSample(&tri, sample, &sampleTri);
+
+                    Headless_CountCoverage(
+                        &sampleTri, width, height, (side == 0) ? front : back);
+                }
+            }
+
+            for (int i = 0; i < width * height; ++i)
+            {
+                if (front[i] != back[i]) mismatches++;
+                if (front[i]) coveredPixels++;
+            }
+        }
+    }
+
+    printf("Etanchéité : %d vues, %lld pixels couverts, %lld pixels incohérents\n",
+        options->watertightViews, coveredPixels, mismatches);
+
+    free(front);
+    free(back);
+    free(projected);
+
+    return (mismatches == 0) ? EXIT_SUCCESS : EXIT_FAILURE;
+
+ERROR_LABEL:
+    printf("ERROR - Headless_CheckWatertight()\n");
+    assert(false);
+    free(front);
+    free(back);
+    free(projected);
+    return EXIT_FAILURE;
+}
+
+int main(int argc, char *argv[])
+{
+    Renderer *renderer = NULL;
+    Scene *scene = NULL;
+    Mesh *mesh = NULL;
+    HeadlessOptions options = { 0 };
+
+    int exitStatus = Headless_ParseOptions(&options, argc, argv);
+    if (exitStatus != EXIT_SUCCESS) return EXIT_FAILURE;
+
+    // Initialise la SDL sans fenêtre et crée le moteur de rendu hors écran
+    exitStatus = Settings_InitSDLHeadless();
+    if (exitStatus != EXIT_SUCCESS) goto ERROR_LABEL;
+
+    // Vérification de l'étanchéité : le mesh est rastérisé sans moteur de rendu
+    if (options.watertightViews > 0)
+    {
+        mesh = Mesh_LoadOBJ(options.folder, options.fileName);
+        if (!mesh) goto ERROR_LABEL;
+
+        exitStatus = Headless_CheckWatertight(mesh, &options);
+        Mesh_Free(mesh);
+        Settings_QuitSDL();
+
+        return exitStatus;
+    }
+
+    renderer = Renderer_NewOffscreen(options.width, options.height);
+    if (!renderer) goto ERROR_LABEL;
+
+    if (options.msaa)
+    {
+        exitStatus = Renderer_SetSampleCount(renderer, RASTER_MSAA_SAMPLES);
+        if (exitStatus != EXIT_SUCCESS) goto ERROR_LABEL;
+    }
+    if (options.hdr)
+    {
+        exitStatus = Renderer_SetHdr(renderer, true);
+        if (exitStatus != EXIT_SUCCESS) goto ERROR_LABEL;
+    }
+
+    if (options.targetTime > 0.0f)
+    {
+        exitStatus = Renderer_SetDynamicResolution(renderer, options.targetTime / 1000.0f);
+        if (exitStatus != EXIT_SUCCESS) goto ERROR_LABEL;
+    }
+
+    exitStatus = Renderer_SetShadingMode(renderer, (RendererShadingMode)options.shadingMode);
+    if (exitStatus != EXIT_SUCCESS) goto ERROR_LABEL;
+
+    g_time = Timer_New();
+    if (!g_time) goto ERROR_LABEL;
+
+    // Crée la scène
+    scene = Scene_NewWithRenderer(renderer);
+    if (!scene) goto ERROR_LABEL;
+
+    Scene_SetWireframe(scene, options.wireframe);
+
+    mesh = Scene_CreateMeshFromOBJ(scene, options.folder, options.fileName);
+    if (!mesh) goto ERROR_LABEL;
+
+    // Arbre de scène
+    Object *root   = Scene_GetRoot(scene);
+
+    // Vues côte à côte, la première utilise la caméra de la scène
+    GraphicsView views[HEADLESS_MAX_VIEWS] = { 0 };
+    int viewCount = options.viewCount;
+    int viewWidth = options.width / viewCount;
+    for (int v = 0; v < viewCount; ++v)
+    {
+        Camera *camera = Scene_GetCamera(scene);
+        if (v > 0)
+        {
+            camera = (Camera *)Scene_CreateObject(scene, sizeof(Camera));
+            if (!camera) goto ERROR_LABEL;
+
+            exitStatus = Camera_Init(camera, scene, Mat4_Identity, root);
+            if (exitStatus != EXIT_SUCCESS) goto ERROR_LABEL;
+        }
+
+        // La dernière vue occupe le reste de la largeur
+        int x = v * viewWidth;
+        int w = (v == viewCount - 1) ? options.width - x : viewWidth;
+        Camera_SetAspectRatio(camera, (float)w, (float)options.height);
+
+        views[v].camera = camera;
+        views[v].viewport = (SDL_Rect){ x, 0, w, options.height };
+    }
+
+    if (options.reversedZ)
+    {
+        exitStatus = Scene_SetDepthFormat(scene, RENDERER_DEPTH_FLOAT_REVERSED, views, viewCount);
+        if (exitStatus != EXIT_SUCCESS) goto ERROR_LABEL;
+    }
+
+    // Crée l'objet
+    Object *object = Scene_CreateObject(scene, sizeof(Object));
+    if (!object) goto ERROR_LABEL;
+
+    exitStatus = Object_Init(object, scene, Mat4_Identity, root);
+    if (exitStatus != EXIT_SUCCESS) goto ERROR_LABEL;
+
+    Object_SetMesh(object, mesh);
+
+    // Centre l'objet en (0,0,0) et applique une échelle normalisée
+    float xSize = fabsf(mesh->m_max.x - mesh->m_min.x);
+    float ySize = fabsf(mesh->m_max.y - mesh->m_min.y);
+    float zSize = fabsf(mesh->m_max.z - mesh->m_min.z);
+    float scale = 3.0f / fmaxf(xSize, fmaxf(ySize, zSize));
+
+    Mat4 objectTransform = Mat4_GetTranslationMatrix(Vec3_Neg(mesh->m_center));
+    objectTransform = Mat4_MulMM(Mat4_GetScaleMatrix(scale), objectTransform);
+    Object_SetLocalTransform(object, objectTransform);
+
+    // Lumière fixe
+    Light *light = Scene_GetLights(scene)[0];
+    Light_SetLightDirection(light, Vec3_Normalize(Vec3_Set(-1.0f, 0.0f, 0.0f)));
+
+    Uint64 frequency = SDL_GetPerformanceFrequency();
+    Uint64 renderTicks = 0;
+    Uint64 saveTicks = 0;
+    long long fragments = 0;
+    long long saved = 0;
+
+    for (int frame = 0; frame < options.frameCount; ++frame)
+    {
+        // Met à jour les caméras, réparties autour de l'objet
+        float cameraY = options.orbit ? 360.0f * (float)frame / (float)options.frameCount : 0.0f;
+        for (int v = 0; v < viewCount; ++v)
+        {
+            float angle = cameraY + 360.0f * (float)v / (float)viewCount;
+            Mat4 cameraModel = Mat4_GetTranslationMatrix(Vec3_Set(0.0f, 0.0f, options.camDistance));
+            cameraModel = Mat4_MulMM(Mat4_GetYRotationMatrix(angle), cameraModel);
+            Object_SetTransform((Object *)views[v].camera, root, cameraModel);
+        }
+
+        // Calcule le rendu de la scène dans les buffers du moteur de rendu
+        Uint64 start = SDL_GetPerformanceCounter();
+        Scene_RenderViews(scene, views, viewCount);
+        Renderer_Update(renderer);
+        renderTicks += SDL_GetPerformanceCounter() - start;
+
+        RendererStats stats = Renderer_GetStats(renderer);
+        fragments += stats.fragmentsShaded;
+        saved += stats.shadingInvocationsSaved;
+
+        // Enregistre chaque image avec un motif, sinon uniquement la dernière
+        bool lastFrame = (frame == options.frameCount - 1);
+        if (options.output && (lastFrame || strchr(options.output, '%')))
+        {
+            start = SDL_GetPerformanceCounter();
+            exitStatus = Headless_SaveFrame(renderer, options.output, frame);
+            if (exitStatus != EXIT_SUCCESS) goto ERROR_LABEL;
+            saveTicks += SDL_GetPerformanceCounter() - start;
+        }
+    }
+
+    double renderTime = (double)renderTicks / (double)frequency;
+    printf("%d x %d, %d images : rendu = %.2f ms/image (%.1f FPS), enregistrement = %.1f ms\n",
+        options.width, options.height, options.frameCount,
+        1000.0 * renderTime / options.frameCount,
+        (double)options.frameCount / renderTime,
+        1000.0 * (double)saveTicks / (double)frequency);
+    if (options.shadingMode != RENDERER_SHADING_FULL)
+    {
+        printf("Ombrage à taux variable : %.0f exécutions évitées par image (%.1f %%)\n",
+            (double)saved / options.frameCount,
+            (fragments > 0) ? 100.0 * (double)saved / (double)fragments : 0.0);
+    }
+    if (options.targetTime > 0.0f)
+    {
+        printf("Résolution dynamique : échelle = %.2f, durée moyenne = %.2f ms\n",
+            Renderer_GetResolutionScale(renderer), 1000.0f * Renderer_GetFrameTime(renderer));
+    }
+
+    Scene_FreeLights(scene);
+    Scene_Free(scene);
+    Timer_Free(g_time);
+    Renderer_Free(renderer);
+
+    Settings_QuitSDL();
+
+    return EXIT_SUCCESS;
+
+ERROR_LABEL:
+    printf("ERROR - main()\n");
+    assert(false);
+    Scene_Free(scene);
+    Timer_Free(g_time);
+    Renderer_Free(renderer);
+    return EXIT_FAILURE;
+}
@@ -1,52 +1,91 @@
-﻿#include "Camera.h"
-#include "Matrix.h"
-#include "Vector.h"
-#include "Window.h"
-#include "Graphics.h"
-
-void Camera_VM_Destroy(Object *object);
-
-static ObjectVMT ObjectVMT_Camera = {
-    .Destroy = Camera_VM_Destroy
-};
-
-int Camera_Init(Camera *camera, Scene *scene, Mat4 localTransform, Object *parent)
-{
-    assert(camera && scene);
-
-    int exitStatus = Object_Init(
-        (Object *)camera, scene, localTransform, parent);
-    if (exitStatus != EXIT_SUCCESS) goto ERROR_LABEL;
-
-    ((Object *)camera)->m_vptr = &ObjectVMT_Camera;
-
-    // Valeurs paramètrables :
-    // - fov (field of view) : angle de vue
-    // - near : profondeur minimale visible
-    // - far  : profondeur maximale visible
-    float fov = 60.0f;
-    float near = 1.0f;
-    float far = 50.f;
-
-    float right = tanf((fov / 2.0f) * ((float)M_PI / 180.0f));
-    float top = right * 9.0f / 16.0f;
-
-    camera->m_projMatrix = Mat4_GetProjectionMatrix(-right, right, -top, top, near, far);
-
-    return EXIT_SUCCESS;
-
-ERROR_LABEL:
-    printf("ERROR - Camera_Init()\n");
-    assert(false);
-    return EXIT_FAILURE;
-}
-
-void Camera_VM_Destroy(Object *object)
-{
-    // Libère les allocations de la caméra
-}
-
-void Camera_SetProjectionMatrix(Camera *camera, Mat4 matrix)
-{
-    camera->m_projMatrix = matrix;
-}
+#include "Camera.h"
+#include "Matrix.h"
+#include "Vector.h"
+#include "Window.h"
+#include "Graphics.h"
+
+void Camera_VM_Destroy(Object *object);
+
+static ObjectVMT ObjectVMT_Camera = {
+    .Destroy = Camera_VM_Destroy
+};
+
+/// @brief Calcule la matrice de projection de la caméra à partir de ses paramètres.
+static void Camera_UpdateProjectionMatrix(Camera *camera)
+{
+    float right = tanf((camera->m_fov / 2.0f) * ((float)M_PI / 180.0f));
+    float top = right * camera->m_aspectHeight / camera->m_aspectWidth;
+    float far = camera->m_infiniteFar ? INFINITY : camera->m_far;
+
+    if (camera->m_reversedZ)
+    {
+        camera->m_projMatrix = Mat4_GetReversedProjectionMatrix(
+            -right, right, -top, top, camera->m_near, far);
+    }
+    else
+    {
+        camera->m_projMatrix = Mat4_GetProjectionMatrix(
+            -right, right, -top, top, camera->m_near, far);
+    }
+}
+
+int Camera_Init(Camera *camera, Scene *scene, Mat4 localTransform, Object *parent)
+{
+    assert(camera && scene);
+
+    int exitStatus = Object_Init(
+        (Object *)camera, scene, localTransform, parent);
+    if (exitStatus != EXIT_SUCCESS) goto ERROR_LABEL;
+
+    ((Object *)camera)->m_vptr = &ObjectVMT_Camera;
+
+    // Valeurs paramètrables :
+    // - fov (field of view) : angle de vue
+    // - near : profondeur minimale visible
+    // - far  : profondeur maximale visible
+    // - reversedZ, infiniteFar : intervalle de profondeur (voir Camera_SetDepthRange())
+    // - aspectWidth, aspectHeight : proportions de l'image (voir Camera_SetAspectRatio())
+    camera->m_fov = 60.0f;
+    camera->m_near = 1.0f;
+    camera->m_far = 50.f;
+    camera->m_reversedZ = false;
+    camera->m_infiniteFar = false;
+    camera->m_aspectWidth = 16.0f;
+    camera->m_aspectHeight = 9.0f;
+
+    Camera_UpdateProjectionMatrix(camera);
+
+    return EXIT_SUCCESS;
+
+ERROR_LABEL:
+    printf("ERROR - Camera_Init()\n");
+    assert(false);
+    return EXIT_FAILURE;
+}
+
+void Camera_VM_Destroy(Object *object)
+{
+    // Libère les allocations de la caméra
+}
+
+void Camera_SetDepthRange(Camera *camera, bool reversedZ, bool infiniteFar)
+{
+    camera->m_reversedZ = reversedZ;
+    camera->m_infiniteFar = infiniteFar;
+
+    Camera_UpdateProjectionMatrix(camera);
+}
+
+void Camera_SetAspectRatio(Camera *camera, float width, float height)
+{
+    assert(width > 0.0f && height > 0.0f);
+    camera->m_aspectWidth = width;
+    camera->m_aspectHeight = height;
+
+    Camera_UpdateProjectionMatrix(camera);
+}
+
+void Camera_SetProjectionMatrix(Camera *camera, Mat4 matrix)
+{
+    camera->m_projMatrix = matrix;
+}
@@ -1,24 +1,76 @@
-﻿#pragma once
-
-/// @file Camera.h
-/// @defgroup Camera
-/// @{
-
-#include "Settings.h"
-#include "Object.h"
-
-/// @brief Structure représentant la caméra par laquelle est vue la scène.
-typedef struct Camera_s
-{
-    Object m_base;
-    Mat4   m_projMatrix;
-} Camera;
-
-int Camera_Init(Camera *camera, Scene *scene, Mat4 localTransform, Object* parent);
-
-/// @brief Définit la matrice de projection utilisé par la caméra.
-/// @param[in] camera la caméra.
-/// @param[in] matrix la matrice de projection.
-void Camera_SetProjectionMatrix(Camera *camera, Mat4 matrix);
-
-/// @}
+#pragma once
+
+/// @file Camera.h
+/// @defgroup Camera
+/// @{
+
+#include "Settings.h"
+#include "Object.h"
+
+/// @brief Structure représentant la caméra par laquelle est vue la scène.
+typedef struct Camera_s
+{
+    Object m_base;
+    Mat4   m_projMatrix;
+
+    /// @brief Angle de vue horizontal en degrés.
+    float m_fov;
+
+    /// @brief Distance du plan near.
+    float m_near;
+
+    /// @brief Distance du plan far.
+    float m_far;
+
+    /// @brief Indique si la projection est inversée (reverse-Z, z dans [0, 1]).
+    bool m_reversedZ;
+
+    /// @brief Indique si le plan far est rejeté à l'infini.
+    bool m_infiniteFar;
+
+    /// @brief Largeur et hauteur relatives de l'image (16:9 par défaut).
+    float m_aspectWidth;
+    float m_aspectHeight;
+} Camera;
+
+int Camera_Init(Camera *camera, Scene *scene, Mat4 localTransform, Object* parent);
+
+/// @brief Définit l'intervalle de profondeur de la projection de la caméra
+/// et recalcule sa matrice de projection.
+/// La projection inversée doit être utilisée avec le format de profondeur
+/// RENDERER_DEPTH_FLOAT_REVERSED (voir Scene_SetDepthFormat()).
+/// @param[in,out] camera la caméra.
+/// @param reversedZ true pour une projection inversée (z = 1 sur le plan near
+/// et z = 0 sur le plan far), false pour la projection standard (z dans [-1, 1]).
+/// @param infiniteFar true pour rejeter le plan far à l'infini.
+void Camera_SetDepthRange(Camera *camera, bool reversedZ, bool infiniteFar);
+
+/// @brief Définit les proportions de l'image vue par la caméra
+/// et recalcule sa matrice de projection.
+/// @param[in,out] camera la caméra.
+/// @param width, height la largeur et la hauteur relatives de l'image,
+/// par exemple les dimensions en pixels du moteur de rendu.
+void Camera_SetAspectRatio(Camera *camera, float width, float height);
+
+/// @brief Renvoie un booléen indiquant si la projection de la caméra est inversée.
+/// @param[in] camera la caméra.
+/// @return true si la projection est inversée (reverse-Z).
+INLINE bool Camera_GetReversedZ(Camera *camera)
+{
+    return camera->m_reversedZ;
+}
+
+/// @brief Renvoie un booléen indiquant si le plan far de la caméra est à l'infini.
+/// @param[in] camera la caméra.
+/// @return true si le plan far est à l'infini.
+INLINE bool Camera_GetInfiniteFar(Camera *camera)
+{
+    return camera->m_infiniteFar;
+}
+
+/// @brief Définit la matrice de projection utilisé par la caméra.
+/// @param[in] camera la caméra.
+/// @param[in] matrix la matrice de projection.
+void Camera_SetProjectionMatrix(Camera *camera, Mat4 matrix);
+
+/// @}
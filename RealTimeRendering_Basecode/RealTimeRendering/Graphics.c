@@ -1,220 +1,1378 @@
-#include "Graphics.h"
-#include "Tools.h"
-#include "Shader.h"
-
-/// @brief Indique si la clipPos d'un point appartient au frustum reprsentant
-/// les objects visibles par la camra.
-/// @param clipPos la clipPos d'un point dans le repre camra
-/// @return true si le point est visible, false sinon.
-bool Graphics_Clip(Vec3 clipPos)
-{
-    return
-        (clipPos.x < -1.0f) || (clipPos.x > 1.0f) ||
-        (clipPos.y < -1.0f) || (clipPos.y > 1.0f) ||
-        (clipPos.z < -1.0f) || (clipPos.z > 1.0f);
-}
-
-void Graphics_RenderObject(
-    Renderer *renderer, Object *object,
-    VertexShader *vertShader, FragmentShader *fragShader)
-{
-    if (!object->m_mesh)
-        return;
-
-    Scene *scene = Object_getScene(object);
-    Camera *camera = Scene_GetCamera(scene);
-    Mesh *mesh = object->m_mesh;
-    bool wireframe = Scene_GetWireframe(scene);
-
-    VShaderGlobals vertGlobals = { 0 };
-
-    Mat4 viewToWorld = Object_GetModelMatrix((Object *)camera);
-    Mat4 worldToView = Mat4_Inv(viewToWorld);
-    Mat4 objToWorld = Object_GetModelMatrix(object);
-    Mat4 objToView = Mat4_MulMM(worldToView, objToWorld);
-    
-    vertGlobals.cameraPos = Vec3_From4(Mat4_MulMV(viewToWorld, Vec4_ZeroH));
-    vertGlobals.viewToWorld = viewToWorld;
-    vertGlobals.objToWorld = objToWorld;
-    vertGlobals.objToView = objToView;
-    vertGlobals.objToClip = Mat4_MulMM(camera->m_projMatrix, objToView);
-
-    int i;
-    int triangleCount = mesh->m_triangleCount;
-
-#pragma omp parallel for num_threads(4)
-    for (i = 0; i < triangleCount; ++i)
-    {
-        Triangle *triangle = mesh->m_triangles + i;
-        VShaderIn in[3] = { 0 };
-        VShaderOut out[3] = { 0 };
-        bool clip = true;
-
-        for (int j = 0; j < 3; ++j)
-        {
-            // Calcule l'entre du vertex shader
-            in[j].vertex = mesh->m_vertices[triangle->m_vertexIndices[j]];
-            in[j].normal = mesh->m_normals[triangle->m_normalIndices[j]];
-            in[j].tangent = mesh->m_tangents[triangle->m_vertexIndices[j]];
-            if (mesh->m_textUVs)
-            {
-                in[j].textUV = mesh->m_textUVs[triangle->m_textUVIndices[j]];
-            }
-
-            // VERTEX SHADER
-            out[j] = vertShader(&in[j], &vertGlobals);
-
-            // Clipping
-            clip = clip && Graphics_Clip(out[j].clipPos);
-        }
-        if (clip)
-        {
-            continue;
-        }
-
-        if (!wireframe)
-        {
-            // Calcule des variables globales du fragment shader
-            int materialIndex = triangle->m_materialIndex;
-            Material *material = NULL;
-            if (materialIndex >= 0)
-            {
-                material = mesh->m_materials + materialIndex;
-            }
-
-            FShaderGlobals fragGlobals = { 0 };
-            fragGlobals.material = material;
-            fragGlobals.cameraPos = vertGlobals.cameraPos;
-            fragGlobals.scene = scene;
-
-            // Calcule le rendu du triangle
-            Graphics_RenderTriangle(renderer, out, fragShader, &fragGlobals);
-        }
-        else
-        {
-            // Dessine en fil de fer
-            Vec4 lineColor = Vec4_Set(1.0f, 1.0f, 1.0f, 1.0f);
-            Renderer_DrawLine(renderer, out[0].clipPos, out[1].clipPos, lineColor);
-            Renderer_DrawLine(renderer, out[1].clipPos, out[2].clipPos, lineColor);
-            Renderer_DrawLine(renderer, out[2].clipPos, out[0].clipPos, lineColor);
-        }
-    }
-}
-
-#define VEC2_INIT_INTERPOLATION(vShaderO, member) \
-for (int i = 0; i < 3; ++i) \
-{ \
-    float invDepth = vShaderO[i].invDepth; \
-    vShaderO[i].member.x *= invDepth; \
-    vShaderO[i].member.y *= invDepth; \
-}
-
-#define VEC3_INIT_INTERPOLATION(vShaderO, member) \
-for (int i = 0; i < 3; ++i) \
-{ \
-    float invDepth = vShaderO[i].invDepth; \
-    vShaderO[i].member.x *= invDepth; \
-    vShaderO[i].member.y *= invDepth; \
-    vShaderO[i].member.z *= invDepth; \
-}
-
-#define VEC2_INTERPOLATE(vShaderO, member, result) \
-for (int i = 0; i < 2; ++i) \
-{ \
-    result.data[i] = \
-        w[0] * vShaderO[0].member.data[i] + \
-        w[1] * vShaderO[1].member.data[i] + \
-        w[2] * vShaderO[2].member.data[i]; \
-    result.data[i] *= z; \
-}
-
-#define VEC3_INTERPOLATE(vShaderO, member, result) \
-for (int i = 0; i < 3; ++i) \
-{ \
-    result.data[i] = \
-        w[0] * vShaderO[0].member.data[i] + \
-        w[1] * vShaderO[1].member.data[i] + \
-        w[2] * vShaderO[2].member.data[i]; \
-    result.data[i] *= z; \
-}
-
-void Graphics_RenderTriangle(
-    Renderer *renderer, VShaderOut *vShaderO,
-    FragmentShader *fragShader, FShaderGlobals *fragGlobals)
-{
-    int w = Renderer_GetWidth(renderer);
-    int h = Renderer_GetHeight(renderer);
-
-    // Conversion clip space vers raster space
-    Vec2 rasterVertices[3];
-    for (int i = 0; i < 3; ++i)
-    {
-        rasterVertices[i].x = w * (vShaderO[i].clipPos.x + 1.0f) / 2.0f;
-        rasterVertices[i].y = h * (vShaderO[i].clipPos.y + 1.0f) / 2.0f;
-    }
-
-    float area = Vec2_SignedArea(
-        rasterVertices[0], rasterVertices[1], rasterVertices[2]
-    );
-    if (area < 0.0f)
-    {
-        // Une aire ngative signifie que le triangle est dernire l'objet
-        return;
-    }
-
-    // Interpolation correcte en perspective
-    VEC2_INIT_INTERPOLATION(vShaderO, textUV);
-    VEC3_INIT_INTERPOLATION(vShaderO, normal);
-    VEC3_INIT_INTERPOLATION(vShaderO, tangent);
-    VEC3_INIT_INTERPOLATION(vShaderO, worldPos);
-
-    // Calcule la bote englobante du triangle
-    Vec2 lower = rasterVertices[0];
-    Vec2 upper = rasterVertices[0];
-    for (int i = 1; i < 3; ++i)
-    {
-        lower = Vec2_Min(lower, rasterVertices[i]);
-        upper = Vec2_Max(upper, rasterVertices[i]);
-    }
-    int xmin = Int_Clamp((int)lower.x, 0, w - 1);
-    int xmax = Int_Clamp((int)upper.x, 0, w - 1);
-    int ymin = Int_Clamp((int)lower.y, 0, h - 1);
-    int ymax = Int_Clamp((int)upper.y, 0, h - 1);
-
-    float z0 = vShaderO[0].clipPos.z;
-    float z1 = vShaderO[1].clipPos.z;
-    float z2 = vShaderO[2].clipPos.z;
-
-    for (int x = xmin; x <= xmax; ++x)
-    {
-        for (int y = ymin; y <= ymax; ++y)
-        {
-            Vec2 p = Vec2_Set(x + 0.5f, y + 0.5f);
-            float w[3];
-            bool inside = Vec2_Barycentric(rasterVertices, p, w);
-            if (!inside)
-            {
-                // Le pixel n'appartient pas au triangle
-                continue;
-            }
-            float z = 1.0f / (
-                w[0] * vShaderO[0].invDepth +
-                w[1] * vShaderO[1].invDepth +
-                w[2] * vShaderO[2].invDepth);
-
-            // Interpolation barycentrique
-            FShaderIn fShaderI = { 0 };
-            VEC3_INTERPOLATE(vShaderO, normal,   fShaderI.normal);
-            VEC3_INTERPOLATE(vShaderO, tangent,   fShaderI.tangent);
-            VEC2_INTERPOLATE(vShaderO, textUV,   fShaderI.textUV);
-            VEC2_INTERPOLATE(vShaderO, worldPos,   fShaderI.worldPos);
-
-            // FRAGMENT SHADER
-            Vec4 color = fragShader(&fShaderI, fragGlobals);
-
-            // Dfinit le pixel si sa zValue est infrieure  celle du z-buffer
-            float zValue = w[0] * z0 + w[1] * z1 + w[2] * z2;
-            Renderer_SetPixel(renderer, x, y, zValue, color, true);
-        }
-    }
-}
+#include "Graphics.h"
+#include "Tools.h"
+#include "Shader.h"
+#include "TileBins.h"
+
+/// @brief Renvoie la distance signée (à un facteur près) entre un sommet et un
+/// plan de découpage. Elle est positive du côté intérieur du plan.
+/// @param reversedZ true si la projection est inversée (voir Graphics_ComputeOutcode()).
+/// @param guardBand les demi-largeurs de la bande de garde (voir Graphics_GetGuardBand()).
+static float Graphics_ClipDistance(
+    Vec4 h, GraphicsClipPlane plane, bool reversedZ, Vec2 guardBand)
+{
+    const float gx = guardBand.x;
+    const float gy = guardBand.y;
+    switch (plane)
+    {
+    case GRAPHICS_CLIP_LEFT:    return h.w + h.x;
+    case GRAPHICS_CLIP_RIGHT:   return h.w - h.x;
+    case GRAPHICS_CLIP_BOTTOM:  return h.w + h.y;
+    case GRAPHICS_CLIP_TOP:     return h.w - h.y;
+    case GRAPHICS_CLIP_NEAR:    return reversedZ ? h.w - h.z : h.w + h.z;
+    case GRAPHICS_CLIP_FAR:     return reversedZ ? h.z : h.w - h.z;
+    case GRAPHICS_GUARD_LEFT:   return gx * h.w + h.x;
+    case GRAPHICS_GUARD_RIGHT:  return gx * h.w - h.x;
+    case GRAPHICS_GUARD_BOTTOM: return gy * h.w + h.y;
+    case GRAPHICS_GUARD_TOP:    return gy * h.w - h.y;
+    default:
+        assert(false);
+        return 0.0f;
+    }
+}
+
+/// @brief Calcule la demi-largeur de la bande de garde sur un axe du rectangle
+/// de projection (origine et taille en pixels).
+static float Graphics_GetGuardBandAxis(int origin, int size)
+{
+    // Coordonnée raster d'un sommet en g : origin + size * (1 + g) / 2.
+    // La marge absorbe les erreurs d'arrondi des sommets créés par le découpage.
+    const float margin = 1.0f;
+    float g = 2.0f * (RASTER_MAX_COORD - margin - (float)origin) / (float)size - 1.0f;
+    return Float_Clamp(g, 1.0f, GRAPHICS_GUARD_BAND);
+}
+
+Vec2 Graphics_GetGuardBand(Renderer *renderer)
+{
+    SDL_Rect viewport = Renderer_GetRenderViewport(renderer);
+    assert(viewport.x + viewport.w <= RASTER_MAX_COORD);
+    assert(viewport.y + viewport.h <= RASTER_MAX_COORD);
+
+    return Vec2_Set(
+        Graphics_GetGuardBandAxis(viewport.x, viewport.w),
+        Graphics_GetGuardBandAxis(viewport.y, viewport.h));
+}
+
+int Graphics_ComputeOutcode(Vec4 clipPosH, bool reversedZ, Vec2 guardBand)
+{
+    int outcode = 0;
+    for (int plane = GRAPHICS_CLIP_LEFT; plane <= GRAPHICS_GUARD_TOP; plane <<= 1)
+    {
+        if (Graphics_ClipDistance(clipPosH, (GraphicsClipPlane)plane, reversedZ, guardBand) < 0.0f)
+        {
+            outcode |= plane;
+        }
+    }
+    return outcode;
+}
+
+/// @brief Calcule le sommet situé à la position t sur l'arête allant de v0 à v1.
+static VShaderOut Graphics_LerpVertex(VShaderOut *v0, VShaderOut *v1, float t)
+{
+    VShaderOut v = *v0;
+
+    for (int i = 0; i < 4; ++i)
+    {
+        v.clipPosH.data[i] = Float_Lerp(v0->clipPosH.data[i], v1->clipPosH.data[i], t);
+    }
+    for (int i = 0; i < 3; ++i)
+    {
+        v.normal.data[i] = Float_Lerp(v0->normal.data[i], v1->normal.data[i], t);
+        v.worldPos.data[i] = Float_Lerp(v0->worldPos.data[i], v1->worldPos.data[i], t);
+        v.tangent.data[i] = Float_Lerp(v0->tangent.data[i], v1->tangent.data[i], t);
+        v.bitangent.data[i] = Float_Lerp(v0->bitangent.data[i], v1->bitangent.data[i], t);
+    }
+    for (int i = 0; i < 2; ++i)
+    {
+        v.textUV.data[i] = Float_Lerp(v0->textUV.data[i], v1->textUV.data[i], t);
+    }
+
+    // La profondeur dans le repère caméra est affine le long de l'arête
+    // (elle est nulle et non infinie pour un sommet sur le plan de la caméra)
+    float depth = Float_Lerp(1.0f / v0->invDepth, 1.0f / v1->invDepth, t);
+    v.invDepth = 1.0f / depth;
+    v.clipPos = Vec3_From4(v.clipPosH);
+
+    return v;
+}
+
+int Graphics_ClipTriangle(
+    VShaderOut *vertices, int planes, bool reversedZ, Vec2 guardBand, VShaderOut *polygon)
+{
+    VShaderOut buffer[GRAPHICS_MAX_CLIP_VERTICES];
+    VShaderOut *src = buffer;
+    VShaderOut *dst = polygon;
+    int count = 3;
+
+    // Le nombre de plans étant impair ou pair, on commence par le tampon qui
+    // permet de terminer dans le polygone de sortie
+    int planeCount = 0;
+    for (int plane = GRAPHICS_CLIP_NEAR; plane <= GRAPHICS_GUARD_TOP; plane <<= 1)
+    {
+        if (planes & plane & GRAPHICS_CLIP_GEOMETRIC)
+            planeCount++;
+    }
+    if (planeCount % 2 == 0)
+    {
+        src = polygon;
+        dst = buffer;
+    }
+    for (int i = 0; i < 3; ++i)
+    {
+        src[i] = vertices[i];
+    }
+
+    // Algorithme de Sutherland-Hodgman
+    for (int plane = GRAPHICS_CLIP_NEAR; plane <= GRAPHICS_GUARD_TOP; plane <<= 1)
+    {
+        if ((planes & plane & GRAPHICS_CLIP_GEOMETRIC) == 0)
+            continue;
+
+        int newCount = 0;
+        for (int i = 0; i < count; ++i)
+        {
+            VShaderOut *v0 = src + i;
+            VShaderOut *v1 = src + (i + 1) % count;
+            float d0 = Graphics_ClipDistance(
+                v0->clipPosH, (GraphicsClipPlane)plane, reversedZ, guardBand);
+            float d1 = Graphics_ClipDistance(
+                v1->clipPosH, (GraphicsClipPlane)plane, reversedZ, guardBand);
+
+            if (d0 >= 0.0f)
+            {
+                dst[newCount++] = *v0;
+            }
+            if ((d0 >= 0.0f) != (d1 >= 0.0f))
+            {
+                // L'arête traverse le plan
+                dst[newCount++] = Graphics_LerpVertex(v0, v1, d0 / (d0 - d1));
+            }
+        }
+        assert(newCount <= GRAPHICS_MAX_CLIP_VERTICES);
+
+        count = newCount;
+        VShaderOut *tmp = src;
+        src = dst;
+        dst = tmp;
+
+        if (count < 3)
+            return 0;
+    }
+
+    assert(src == polygon);
+    return count;
+}
+
+/// @brief Calcule le rectangle de l'écran contenant les arêtes d'un triangle
+/// (voir Renderer_DrawLine()).
+/// @param[in] vertices les trois sommets du triangle (projetés).
+/// @param[out] rect le rectangle (xmin, ymin, xmax, ymax), limité au rectangle
+/// de projection (voir Renderer_GetRenderViewport()).
+/// @return false si les arêtes sont hors du rectangle de projection.
+static bool Graphics_GetEdgesRect(Renderer *renderer, VShaderOut *vertices, int *rect)
+{
+    SDL_Rect viewport = Renderer_GetRenderViewport(renderer);
+    float x0 = (float)viewport.x;
+    float y0 = (float)viewport.y;
+    float x1 = (float)(viewport.x + viewport.w);
+    float y1 = (float)(viewport.y + viewport.h);
+
+    float xmin = INFINITY, ymin = INFINITY;
+    float xmax = -INFINITY, ymax = -INFINITY;
+    for (int i = 0; i < 3; ++i)
+    {
+        float x = viewport.x + viewport.w * (vertices[i].clipPos.x + 1.0f) / 2.0f;
+        float y = viewport.y + viewport.h * (vertices[i].clipPos.y + 1.0f) / 2.0f;
+        xmin = fminf(xmin, x);
+        ymin = fminf(ymin, y);
+        xmax = fmaxf(xmax, x);
+        ymax = fmaxf(ymax, y);
+    }
+    if (!(xmax >= x0 && ymax >= y0 && xmin < x1 && ymin < y1))
+        return false;
+
+    rect[0] = (int)fmaxf(floorf(xmin), x0);
+    rect[1] = (int)fmaxf(floorf(ymin), y0);
+    rect[2] = (int)fminf(floorf(xmax), x1 - 1.0f);
+    rect[3] = (int)fminf(floorf(ymax), y1 - 1.0f);
+    return true;
+}
+
+/// @brief Ajoute un triangle visible dans les tuiles qu'il recouvre.
+/// En fil de fer, les tuiles recouvertes par ses arêtes sont aussi utilisées.
+/// @param fill true si le triangle est rastérisé (sa préparation est valide).
+/// @param wireframe true si les arêtes du triangle sont dessinées.
+/// @return EXIT_SUCCESS ou EXIT_FAILURE.
+static int Graphics_BinTriangle(
+    Renderer *renderer, TileBins *bins, int index, bool fill, bool wireframe)
+{
+    if (!wireframe)
+        return TileBins_Add(bins, index);
+
+    BinnedTriangle *binned = bins->m_triangles + index;
+    RasterTriangle *raster = &(binned->raster);
+    int rect[4];
+    if (!Graphics_GetEdgesRect(renderer, binned->vertices, rect))
+    {
+        return fill ? TileBins_Add(bins, index) : EXIT_SUCCESS;
+    }
+    if (fill)
+    {
+        rect[0] = Int_Min(rect[0], raster->xmin);
+        rect[1] = Int_Min(rect[1], raster->ymin);
+        rect[2] = Int_Max(rect[2], raster->xmax);
+        rect[3] = Int_Max(rect[3], raster->ymax);
+    }
+
+    return TileBins_AddRect(bins, index, rect[0], rect[1], rect[2], rect[3]);
+}
+
+/// @brief Dessine la partie des arêtes d'un triangle contenue dans un rectangle
+/// de l'écran (voir BinnedTriangle::edgeMask).
+static void Graphics_DrawEdges(
+    Renderer *renderer, BinnedTriangle *binned, Vec4 color, bool depthTest,
+    int xmin, int ymin, int xmax, int ymax)
+{
+    for (int i = 0; i < 3; ++i)
+    {
+        if ((binned->edgeMask & (1u << i)) == 0)
+            continue;
+
+        Renderer_DrawLineRect(
+            renderer, binned->vertices[i].clipPos, binned->vertices[(i + 1) % 3].clipPos,
+            color, depthTest, xmin, ymin, xmax, ymax);
+    }
+}
+
+/// @brief Calcule les données globales du vertex shader d'un objet vu par une caméra.
+static VShaderGlobals Graphics_GetVertexGlobals(Camera *camera, Mat4 objToWorld)
+{
+    VShaderGlobals vertGlobals = { 0 };
+
+    Mat4 viewToWorld = Object_GetModelMatrix((Object *)camera);
+    Mat4 worldToView = Mat4_Inv(viewToWorld);
+    Mat4 objToView = Mat4_MulMM(worldToView, objToWorld);
+
+    vertGlobals.cameraPos = Vec3_From4(Mat4_MulMV(viewToWorld, Vec4_ZeroH));
+    vertGlobals.viewToWorld = viewToWorld;
+    vertGlobals.objToWorld = objToWorld;
+    vertGlobals.objToView = objToView;
+    vertGlobals.objToClip = Mat4_MulMM(camera->m_projMatrix, objToView);
+
+    return vertGlobals;
+}
+
+/// @brief Recalcule la projection d'un sommet pour une autre caméra.
+/// Seules les sorties du vertex shader qui dépendent de la caméra sont modifiées,
+/// exactement comme dans VertexShader_Base() (sorties obligatoires).
+static void Graphics_ProjectVertex(VShaderOut *out, Vec3 position, VShaderGlobals *globals)
+{
+    Vec4 vertex = Vec4_From3(position, 1.0f);
+    Vec4 vertexCamSpace = Mat4_MulMV(globals->objToView, vertex);
+    Vec4 vertexClipSpace = Mat4_MulMV(globals->objToClip, vertex);
+
+    out->clipPos = Vec3_From4(vertexClipSpace);
+    out->clipPosH = vertexClipSpace;
+    out->invDepth = vertexCamSpace.w / vertexCamSpace.z;
+}
+
+/// @brief Rastérise les triangles visibles en parallèle, un triangle par thread, sans
+/// répartition dans les tuiles (voir RENDERER_WRITE_ATOMIC). Plusieurs threads pouvant
+/// écrire le même pixel, les pixels sont regroupés (profondeur et couleur) et mis à
+/// jour par compare-and-swap ; le test de profondeur a lieu après le fragment shader.
+static void Graphics_RasterizeTrianglesPacked(
+    Renderer *renderer, Scene *scene, TileBins *bins, Vec3 cameraPos,
+    FragmentShader *fragShader)
+{
+    SDL_Rect viewport = Renderer_GetRenderViewport(renderer);
+    int xmax = viewport.x + viewport.w - 1;
+    int ymax = viewport.y + viewport.h - 1;
+    BinnedTriangle *binnedTriangles = bins->m_triangles;
+    int triangleCount = bins->m_triangleCount;
+    bool parallel = (Renderer_GetWriteMode(renderer) == RENDERER_WRITE_ATOMIC);
+
+    Renderer_BeginPackedWrites(renderer);
+
+#pragma omp parallel for if(parallel) schedule(dynamic, 16)
+    for (int i = 0; i < triangleCount; ++i)
+    {
+        BinnedTriangle *binned = binnedTriangles + i;
+
+        // Les triangles découpés sont remplacés par leur éventail
+        if (!binned->visible || binned->clipPlanes)
+            continue;
+
+        FShaderGlobals fragGlobals = { 0 };
+        fragGlobals.cameraPos = cameraPos;
+        fragGlobals.scene = scene;
+        fragGlobals.material = binned->material;
+
+        Graphics_RasterizeTriangle(
+            renderer, &(binned->planes), &(binned->raster),
+            viewport.x, viewport.y, xmax, ymax, fragShader, &fragGlobals, true);
+    }
+
+    Renderer_EndPackedWrites(renderer);
+}
+
+/// @brief Calcule le rendu des triangles d'un mesh dont les sommets sont projetés
+/// pour une vue (assemblage, découpage, répartition dans les tuiles et rastérisation).
+/// La rastérisation est limitée au rectangle de projection du moteur de rendu.
+/// @param vertices les sorties du vertex shader des sommets uniques du mesh.
+/// @param cameraPos la position de la caméra de la vue.
+/// @return EXIT_SUCCESS ou EXIT_FAILURE.
+static int Graphics_RenderMeshView(
+    Renderer *renderer, Scene *scene, Mesh *mesh, VShaderOut *vertices, Vec3 cameraPos,
+    bool reversedZ, FragmentShader *fragShader, bool lateZ)
+{
+    TileBins *bins = Renderer_GetTileBins(renderer);
+    bool wireframe = Scene_GetWireframe(scene);
+    int triangleCount = mesh->m_triangleCount;
+    int i;
+
+    // Les arêtes soumises au test de profondeur sont dessinées sur les triangles
+    // rendus normalement, les autres remplacent le rendu des triangles
+    bool lineDepthTest = wireframe && Scene_GetWireframeDepthTest(scene);
+    bool fill = !wireframe || lineDepthTest;
+    Vec4 lineColor = Vec4_Set(1.0f, 1.0f, 1.0f, 1.0f);
+
+    // Les triangles sont rastérisés sans tuiles avec les écritures regroupées,
+    // le fil de fer utilise toujours les tuiles
+    bool packed = !wireframe && Renderer_GetWriteMode(renderer) != RENDERER_WRITE_TILED;
+
+    // Bande de garde adaptée à la taille du rectangle de projection
+    Vec2 guardBand = Graphics_GetGuardBand(renderer);
+
+    int exitStatus = TileBins_Reset(bins, mesh->m_cornerCount, triangleCount);
+    if (exitStatus != EXIT_SUCCESS)
+        return EXIT_FAILURE;
+
+    BinnedTriangle *binnedTriangles = bins->m_triangles;
+
+    // Etape d'assemblage : chaque triangle est assemblé indépendamment
+    // et n'écrit que dans sa propre case du tableau
+#pragma omp parallel for schedule(static)
+    for (i = 0; i < triangleCount; ++i)
+    {
+        Triangle *triangle = mesh->m_triangles + i;
+        BinnedTriangle *binned = binnedTriangles + i;
+        VShaderOut *out = binned->vertices;
+        int outcodeAnd = ~0;
+        int outcodeOr = 0;
+
+        binned->visible = false;
+        binned->clipPlanes = 0;
+        binned->edgeMask = 0x7;
+
+        for (int j = 0; j < 3; ++j)
+        {
+            // Copie la sortie du vertex shader (utilisée par le découpage)
+            out[j] = vertices[triangle->m_cornerIndices[j]];
+
+            int outcode = Graphics_ComputeOutcode(out[j].clipPosH, reversedZ, guardBand);
+            outcodeAnd &= outcode;
+            outcodeOr |= outcode;
+        }
+        if (outcodeAnd & GRAPHICS_CLIP_FRUSTUM)
+        {
+            // Les trois sommets sont à l'extérieur d'un même plan du frustum
+            Renderer_GetThreadStats(renderer)->trianglesCulled++;
+            continue;
+        }
+
+        // Matériau utilisé par le fragment shader
+        int materialIndex = triangle->m_materialIndex;
+        binned->material = NULL;
+        if (materialIndex >= 0)
+        {
+            binned->material = mesh->m_materials + materialIndex;
+        }
+
+        // Seuls les triangles qui traversent le plan near ou qui sortent de la
+        // bande de garde sont découpés (après l'étape de géométrie)
+        binned->clipPlanes = outcodeOr & GRAPHICS_CLIP_GEOMETRIC;
+        if (!fill || binned->clipPlanes)
+        {
+            binned->visible = true;
+            continue;
+        }
+
+        binned->visible = Graphics_SetupTriangle(
+            renderer, out, &(binned->raster), &(binned->planes));
+    }
+
+    // Répartition des triangles dans les tuiles, dans l'ordre de soumission.
+    // Les triangles découpés sont remplacés par un éventail de triangles
+    // ajoutés à la fin du tableau.
+    long long clipped = 0;
+    for (i = 0; i < triangleCount; ++i)
+    {
+        BinnedTriangle *binned = bins->m_triangles + i;
+        if (!binned->visible)
+            continue;
+
+        if (binned->clipPlanes == 0)
+        {
+            if (packed)
+                continue;
+
+            exitStatus = Graphics_BinTriangle(renderer, bins, i, fill, wireframe);
+            if (exitStatus != EXIT_SUCCESS)
+                return EXIT_FAILURE;
+            continue;
+        }
+
+        VShaderOut polygon[GRAPHICS_MAX_CLIP_VERTICES];
+        int count = Graphics_ClipTriangle(
+            binned->vertices, binned->clipPlanes, reversedZ, guardBand, polygon);
+        Material *material = binned->material;
+        clipped++;
+
+        for (int j = 1; j + 1 < count; ++j)
+        {
+            int index = TileBins_NewTriangle(bins);
+            if (index < 0)
+                return EXIT_FAILURE;
+
+            BinnedTriangle *fan = bins->m_triangles + index;
+            fan->vertices[0] = polygon[0];
+            fan->vertices[1] = polygon[j];
+            fan->vertices[2] = polygon[j + 1];
+            fan->material = material;
+            fan->clipPlanes = 0;
+
+            // Seules les arêtes du polygone sont dessinées en fil de fer
+            fan->edgeMask = 0x2;
+            if (j == 1) fan->edgeMask |= 0x1;
+            if (j + 2 == count) fan->edgeMask |= 0x4;
+
+            fan->visible = !fill || Graphics_SetupTriangle(
+                renderer, fan->vertices, &(fan->raster), &(fan->planes));
+            if (!fan->visible || packed)
+                continue;
+
+            exitStatus = Graphics_BinTriangle(renderer, bins, index, fill, wireframe);
+            if (exitStatus != EXIT_SUCCESS)
+                return EXIT_FAILURE;
+        }
+    }
+    Renderer_GetThreadStats(renderer)->trianglesClipped += clipped;
+    binnedTriangles = bins->m_triangles;
+
+    if (packed)
+    {
+        Graphics_RasterizeTrianglesPacked(renderer, scene, bins, cameraPos, fragShader);
+        return EXIT_SUCCESS;
+    }
+
+    // Etape de rastérisation : chaque tuile est traitée par un seul thread,
+    // un pixel n'a donc qu'un seul écrivain et aucun verrou n'est nécessaire.
+    // Les tuiles sont limitées au rectangle de projection.
+    SDL_Rect viewport = Renderer_GetRenderViewport(renderer);
+    int vxmax = viewport.x + viewport.w - 1;
+    int vymax = viewport.y + viewport.h - 1;
+    int tileCountX = bins->m_tileCountX;
+    int tileCount = TileBins_GetTileCount(bins);
+
+#pragma omp parallel for schedule(dynamic, 1)
+    for (i = 0; i < tileCount; ++i)
+    {
+        TileBin *bin = bins->m_bins + i;
+        int xmin = Int_Max((i % tileCountX) * TILE_SIZE, viewport.x);
+        int ymin = Int_Max((i / tileCountX) * TILE_SIZE, viewport.y);
+        int xmax = Int_Min((i % tileCountX) * TILE_SIZE + TILE_SIZE - 1, vxmax);
+        int ymax = Int_Min((i / tileCountX) * TILE_SIZE + TILE_SIZE - 1, vymax);
+
+        // Une tuile sans triangle garde ses effacements en attente
+        if (bin->m_count == 0 || xmin > xmax || ymin > ymax)
+            continue;
+
+        Renderer_PrepareTile(renderer, i);
+
+        FShaderGlobals fragGlobals = { 0 };
+        fragGlobals.cameraPos = cameraPos;
+        fragGlobals.scene = scene;
+
+        for (int j = 0; fill && j < bin->m_count; ++j)
+        {
+            BinnedTriangle *binned = binnedTriangles + bin->m_indices[j];
+
+            // Calcule le rendu de la partie du triangle contenue dans la tuile
+            fragGlobals.material = binned->material;
+            Graphics_RasterizeTriangle(
+                renderer, &(binned->planes), &(binned->raster),
+                xmin, ymin, xmax, ymax, fragShader, &fragGlobals, lateZ);
+        }
+
+        // Les arêtes sont dessinées après tous les triangles de la tuile
+        for (int j = 0; wireframe && j < bin->m_count; ++j)
+        {
+            Graphics_DrawEdges(
+                renderer, binnedTriangles + bin->m_indices[j], lineColor, lineDepthTest,
+                xmin, ymin, xmax, ymax);
+        }
+    }
+
+    return EXIT_SUCCESS;
+}
+
+void Graphics_RenderObject(
+    Renderer *renderer, Object *object,
+    VertexShader *vertShader, FragmentShader *fragShader, bool lateZ)
+{
+    GraphicsView view = { 0 };
+    view.camera = Scene_GetCamera(Object_getScene(object));
+    view.viewport = Renderer_GetViewport(renderer);
+
+    Graphics_RenderObjectViews(renderer, object, &view, 1, vertShader, fragShader, lateZ);
+}
+
+void Graphics_RenderObjectViews(
+    Renderer *renderer, Object *object, GraphicsView *views, int viewCount,
+    VertexShader *vertShader, FragmentShader *fragShader, bool lateZ)
+{
+    if (!object->m_mesh || viewCount <= 0)
+        return;
+
+    Scene *scene = Object_getScene(object);
+    Mesh *mesh = object->m_mesh;
+    TileBins *bins = Renderer_GetTileBins(renderer);
+    Mat4 objToWorld = Object_GetModelMatrix(object);
+    int i;
+
+    if (!mesh->m_corners)
+    {
+        int exitStatus = Mesh_ComputeCorners(mesh);
+        if (exitStatus != EXIT_SUCCESS)
+            return;
+    }
+    int vertexCount = mesh->m_cornerCount;
+
+    int exitStatus = TileBins_Reset(bins, vertexCount, mesh->m_triangleCount);
+    if (exitStatus != EXIT_SUCCESS)
+        return;
+
+    VShaderOut *vertices = bins->m_vertices;
+    VShaderGlobals vertGlobals = Graphics_GetVertexGlobals(views[0].camera, objToWorld);
+
+    // Etape des sommets : le vertex shader n'est exécuté qu'une fois
+    // par sommet unique (position, normale, uv) du mesh, pour toutes les vues
+#pragma omp parallel for schedule(static)
+    for (i = 0; i < vertexCount; ++i)
+    {
+        MeshCorner *corner = mesh->m_corners + i;
+        VShaderIn in = { 0 };
+
+        // Calcule l'entrée du vertex shader
+        in.vertex = mesh->m_vertices[corner->m_vertexIndex];
+        in.normal = mesh->m_normals[corner->m_normalIndex];
+        in.tangent = mesh->m_tangents[corner->m_vertexIndex];
+        if (mesh->m_textUVs)
+        {
+            in.textUV = mesh->m_textUVs[corner->m_textUVIndex];
+        }
+
+        // VERTEX SHADER
+        vertices[i] = vertShader(&in, &vertGlobals);
+    }
+    Renderer_GetThreadStats(renderer)->verticesShaded += vertexCount;
+
+    SDL_Rect viewport = Renderer_GetViewport(renderer);
+
+    for (int v = 0; v < viewCount; ++v)
+    {
+        Camera *camera = views[v].camera;
+
+        if (v > 0)
+        {
+            // Les sorties du vertex shader exprimées dans le repère monde sont
+            // conservées, seule la projection est recalculée pour la caméra de la vue
+            vertGlobals = Graphics_GetVertexGlobals(camera, objToWorld);
+
+#pragma omp parallel for schedule(static)
+            for (i = 0; i < vertexCount; ++i)
+            {
+                MeshCorner *corner = mesh->m_corners + i;
+                Graphics_ProjectVertex(
+                    vertices + i, mesh->m_vertices[corner->m_vertexIndex], &vertGlobals);
+            }
+            Renderer_GetThreadStats(renderer)->verticesProjected += vertexCount;
+        }
+
+        // La projection de la caméra doit correspondre au format de profondeur
+        bool reversedZ = Camera_GetReversedZ(camera);
+        assert(reversedZ == (Renderer_GetDepthFormat(renderer) == RENDERER_DEPTH_FLOAT_REVERSED));
+
+        Renderer_SetViewport(renderer, views[v].viewport);
+        exitStatus = Graphics_RenderMeshView(
+            renderer, scene, mesh, vertices, vertGlobals.cameraPos,
+            reversedZ, fragShader, lateZ);
+        if (exitStatus != EXIT_SUCCESS)
+            break;
+    }
+
+    Renderer_SetViewport(renderer, viewport);
+}
+
+/// @brief Calcule les équations de plan d'un attribut Vec2 multiplié par invDepth.
+#define VEC2_SETUP_PLANES(raster, vShaderO, member, planes) \
+for (int i = 0; i < 2; ++i) \
+{ \
+    planes[i] = RasterTriangle_GetPlane(raster, \
+        vShaderO[0].member.data[i] * vShaderO[0].invDepth, \
+        vShaderO[1].member.data[i] * vShaderO[1].invDepth, \
+        vShaderO[2].member.data[i] * vShaderO[2].invDepth); \
+}
+
+/// @brief Calcule les équations de plan d'un attribut Vec3 multiplié par invDepth.
+#define VEC3_SETUP_PLANES(raster, vShaderO, member, planes) \
+for (int i = 0; i < 3; ++i) \
+{ \
+    planes[i] = RasterTriangle_GetPlane(raster, \
+        vShaderO[0].member.data[i] * vShaderO[0].invDepth, \
+        vShaderO[1].member.data[i] * vShaderO[1].invDepth, \
+        vShaderO[2].member.data[i] * vShaderO[2].invDepth); \
+}
+
+bool Graphics_SetupTriangle(
+    Renderer *renderer, VShaderOut *vShaderO, RasterTriangle *raster,
+    VShaderPlanes *planes)
+{
+    SDL_Rect viewport = Renderer_GetRenderViewport(renderer);
+
+    // Conversion clip space vers raster space (dans le rectangle de projection)
+    Vec3 rasterVertices[3];
+    for (int i = 0; i < 3; ++i)
+    {
+        rasterVertices[i].x = viewport.x + viewport.w * (vShaderO[i].clipPos.x + 1.0f) / 2.0f;
+        rasterVertices[i].y = viewport.y + viewport.h * (vShaderO[i].clipPos.y + 1.0f) / 2.0f;
+        rasterVertices[i].z = Renderer_GetDepthValue(renderer, vShaderO[i].clipPos.z);
+    }
+
+    // Equations des arêtes (calculées une seule fois par triangle)
+    bool visible = RasterTriangle_Setup(
+        raster, rasterVertices,
+        viewport.x, viewport.y, viewport.x + viewport.w - 1, viewport.y + viewport.h - 1,
+        Renderer_GetSampleCount(renderer));
+
+    RendererStats *stats = Renderer_GetThreadStats(renderer);
+    if (raster->pixelArea > 0.0f)
+    {
+        stats->triangleSizes[Renderer_GetSizeBin(raster->pixelArea)]++;
+    }
+    if (raster->small)
+    {
+        if (visible)
+            stats->trianglesSmall++;
+        else
+            stats->trianglesEmpty++;
+    }
+
+    if (!visible)
+    {
+        // Triangle vu de dos (derrière l'objet), dégénéré, hors de l'écran
+        // ou ne couvrant aucun centre de pixel
+        return false;
+    }
+
+    // Interpolation correcte en perspective : les attributs divisés par la
+    // profondeur et l'inverse de la profondeur sont affines dans le repère raster
+    planes->invDepth = RasterTriangle_GetPlane(
+        raster, vShaderO[0].invDepth, vShaderO[1].invDepth, vShaderO[2].invDepth);
+    VEC3_SETUP_PLANES(raster, vShaderO, normal, planes->normal);
+    VEC2_SETUP_PLANES(raster, vShaderO, textUV, planes->textUV);
+    VEC3_SETUP_PLANES(raster, vShaderO, worldPos, planes->worldPos);
+    VEC3_SETUP_PLANES(raster, vShaderO, tangent, planes->tangent);
+
+    return true;
+}
+
+void Graphics_RenderTriangle(
+    Renderer *renderer, VShaderOut *vShaderO,
+    FragmentShader *fragShader, FShaderGlobals *fragGlobals, bool lateZ)
+{
+    RasterTriangle raster;
+    VShaderPlanes planes;
+    if (!Graphics_SetupTriangle(renderer, vShaderO, &raster, &planes))
+        return;
+
+    Graphics_RasterizeTriangle(
+        renderer, &planes, &raster, 0, 0,
+        Renderer_GetWidth(renderer) - 1, Renderer_GetHeight(renderer) - 1,
+        fragShader, fragGlobals, lateZ);
+}
+
+/// @brief Calcule la valeur d'un attribut Vec2 en un pixel à partir de ses plans.
+#define VEC2_EVAL_PLANES(planes, x, y, z, result) \
+for (int i = 0; i < 2; ++i) \
+{ \
+    result.data[i] = RasterPlane_Eval(planes + i, x, y) * z; \
+}
+
+/// @brief Calcule la valeur d'un attribut Vec3 en un pixel à partir de ses plans.
+#define VEC3_EVAL_PLANES(planes, x, y, z, result) \
+for (int i = 0; i < 3; ++i) \
+{ \
+    result.data[i] = RasterPlane_Eval(planes + i, x, y) * z; \
+}
+
+/// @brief Exécute le fragment shader pour les pixels d'un quad 2x2.
+/// Le quad est l'unité d'ombrage : les coordonnées uv sont interpolées aux
+/// quatre pixels, y compris ceux qui ne sont pas ombrés (pixels auxiliaires),
+/// afin de calculer leurs dérivées par différences finies.
+/// @param qx, qy la position du premier pixel du quad.
+/// @param quadMask le masque des pixels du quad à ombrer (ordre des lanes).
+/// @param[out] colors les couleurs des pixels ombrés.
+static void Graphics_ShadeQuad(
+    VShaderPlanes *planes, int qx, int qy, unsigned quadMask,
+    FragmentShader *fragShader, FShaderGlobals *fragGlobals, Vec4 *colors)
+{
+    float z[4];
+    Vec2 textUV[4];
+
+    for (int k = 0; k < 4; ++k)
+    {
+        // Centre du pixel
+        float px = qx + RASTER_LANE_X(k) + 0.5f;
+        float py = qy + RASTER_LANE_Y(k) + 0.5f;
+
+        // Interpolation correcte en perspective
+        z[k] = 1.0f / RasterPlane_Eval(&(planes->invDepth), px, py);
+        VEC2_EVAL_PLANES(planes->textUV, px, py, z[k], textUV[k]);
+    }
+
+    // Dérivées grossières (une seule valeur par quad)
+    Vec2 ddx = Vec2_Sub(textUV[1], textUV[0]);
+    Vec2 ddy = Vec2_Sub(textUV[2], textUV[0]);
+
+    for (int k = 0; k < 4; ++k)
+    {
+        if ((quadMask & (1u << k)) == 0)
+        {
+            // Pixel auxiliaire : il n'est pas ombré
+            continue;
+        }
+
+        float px = qx + RASTER_LANE_X(k) + 0.5f;
+        float py = qy + RASTER_LANE_Y(k) + 0.5f;
+
+        FShaderIn fShaderI = { 0 };
+        VEC3_EVAL_PLANES(planes->normal, px, py, z[k], fShaderI.normal);
+        VEC3_EVAL_PLANES(planes->tangent, px, py, z[k], fShaderI.tangent);
+        VEC3_EVAL_PLANES(planes->worldPos, px, py, z[k], fShaderI.worldPos);
+        fShaderI.textUV = textUV[k];
+        fShaderI.ddxTextUV = ddx;
+        fShaderI.ddyTextUV = ddy;
+
+        // FRAGMENT SHADER
+        colors[k] = fragShader(&fShaderI, fragGlobals);
+    }
+}
+
+/// @brief Nombre maximal de cellules d'ombrage grossier d'une ligne de cellules
+/// en cache (voir GraphicsShadingCells).
+#define GRAPHICS_MAX_SHADING_CELLS 8
+
+/// @brief Couleurs des cellules d'ombrage grossier d'une ligne de cellules
+/// (voir RendererShadingRate). Les cellules sont alignées sur une grille de
+/// size x size pixels ; un rectangle rastérisé est contenu dans un bloc de taux
+/// constant, ses cellules d'une même ligne tiennent donc dans le cache.
+typedef struct GraphicsShadingCells_s
+{
+    /// @brief Taille des cellules en pixels (1 pour un ombrage par pixel).
+    int size;
+
+    /// @brief Ligne des cellules en cache (y / size).
+    int row;
+
+    /// @brief Colonne de la première cellule en cache (x / size).
+    int column;
+
+    /// @brief Masque des cellules de la ligne déjà ombrées.
+    unsigned valid;
+
+    /// @brief Couleur de chaque cellule ombrée.
+    Vec4 colors[GRAPHICS_MAX_SHADING_CELLS];
+
+    /// @brief Nombre d'exécutions du fragment shader évitées.
+    long long saved;
+} GraphicsShadingCells;
+
+/// @brief Initialise le cache des cellules d'ombrage d'un rectangle
+/// (voir Renderer_GetShadingRate()).
+/// @param x, y le coin inférieur gauche du rectangle.
+/// @param sampleCount le nombre d'échantillons par pixel (taux ignoré en MSAA).
+static void Graphics_InitShadingCells(
+    Renderer *renderer, GraphicsShadingCells *cells, int x, int y, int sampleCount)
+{
+    RendererShadingRate rate = Renderer_GetShadingRate(renderer, x, y);
+
+    cells->size = (sampleCount > 1) ? 1 : (1 << rate);
+    cells->row = -1;
+    cells->column = x / cells->size;
+    cells->valid = 0;
+    cells->saved = 0;
+}
+
+/// @brief Exécute le fragment shader pour un pixel dont la couleur est donnée
+/// à sa cellule d'ombrage grossier. Les dérivées des coordonnées uv sont
+/// calculées avec les pixels voisins et multipliées par la taille de la cellule.
+/// @param x, y la position du pixel.
+/// @param size la taille de la cellule en pixels.
+static Vec4 Graphics_ShadePixel(
+    VShaderPlanes *planes, int x, int y, int size,
+    FragmentShader *fragShader, FShaderGlobals *fragGlobals)
+{
+    // Centre du pixel et de ses voisins de droite et du dessus
+    float px = x + 0.5f;
+    float py = y + 0.5f;
+    float z = 1.0f / RasterPlane_Eval(&(planes->invDepth), px, py);
+    float zx = 1.0f / RasterPlane_Eval(&(planes->invDepth), px + 1.0f, py);
+    float zy = 1.0f / RasterPlane_Eval(&(planes->invDepth), px, py + 1.0f);
+
+    Vec2 textUV, textUVx, textUVy;
+    VEC2_EVAL_PLANES(planes->textUV, px, py, z, textUV);
+    VEC2_EVAL_PLANES(planes->textUV, px + 1.0f, py, zx, textUVx);
+    VEC2_EVAL_PLANES(planes->textUV, px, py + 1.0f, zy, textUVy);
+
+    Vec2 ddx = Vec2_Sub(textUVx, textUV);
+    Vec2 ddy = Vec2_Sub(textUVy, textUV);
+
+    FShaderIn fShaderI = { 0 };
+    VEC3_EVAL_PLANES(planes->normal, px, py, z, fShaderI.normal);
+    VEC3_EVAL_PLANES(planes->tangent, px, py, z, fShaderI.tangent);
+    VEC3_EVAL_PLANES(planes->worldPos, px, py, z, fShaderI.worldPos);
+    fShaderI.textUV = textUV;
+    fShaderI.ddxTextUV = Vec2_Set(ddx.x * size, ddx.y * size);
+    fShaderI.ddyTextUV = Vec2_Set(ddy.x * size, ddy.y * size);
+
+    // FRAGMENT SHADER
+    return fragShader(&fShaderI, fragGlobals);
+}
+
+/// @brief Colore les pixels visibles d'un groupe avec un ombrage grossier : le
+/// fragment shader est exécuté au premier pixel visible de chaque cellule et sa
+/// couleur est réutilisée pour les autres pixels de la cellule. La profondeur de
+/// chaque pixel est conservée.
+/// @param mask le masque des pixels visibles du groupe.
+/// @param zValues la profondeur de chaque pixel du groupe.
+/// @return Le nombre de pixels colorés.
+static long long Graphics_ShadeGroupCoarse(
+    Renderer *renderer, VShaderPlanes *planes, int gx, int gy,
+    unsigned mask, const float *zValues,
+    FragmentShader *fragShader, FShaderGlobals *fragGlobals, GraphicsShadingCells *cells)
+{
+    long long shaded = 0;
+    int size = cells->size;
+
+    for (int k = 0; k < RASTER_LANES; ++k)
+    {
+        if ((mask & (1u << k)) == 0)
+            continue;
+
+        int x = gx + RASTER_LANE_X(k);
+        int y = gy + RASTER_LANE_Y(k);
+
+        // Les groupes sont parcourus ligne par ligne : une nouvelle ligne
+        // de cellules remplace la précédente
+        if (y / size != cells->row)
+        {
+            cells->row = y / size;
+            cells->valid = 0;
+        }
+
+        int cell = x / size - cells->column;
+        assert(cell >= 0 && cell < GRAPHICS_MAX_SHADING_CELLS);
+        if (cells->valid & (1u << cell))
+        {
+            cells->saved++;
+        }
+        else
+        {
+            cells->colors[cell] = Graphics_ShadePixel(
+                planes, x, y, size, fragShader, fragGlobals);
+            cells->valid |= 1u << cell;
+        }
+
+        Renderer_SetPixel(renderer, x, y, zValues[k], cells->colors[cell], true);
+        shaded++;
+    }
+
+    return shaded;
+}
+
+/// @brief Calcule le rendu des pixels d'un groupe en MSAA
+/// (voir Graphics_RasterizeGroup()). La couverture et la profondeur sont
+/// calculées pour chaque échantillon avec le triangle décalé correspondant,
+/// le fragment shader est exécuté une fois par pixel dont au moins un
+/// échantillon est couvert et visible, au centre du pixel.
+/// @param samples les RASTER_MSAA_SAMPLES triangles décalés (voir RasterTriangle_GetSample()).
+/// @param coverageTests le masque des échantillons dont la couverture est testée.
+/// @param[in,out] zmax si non NULL, la profondeur maximale accumulée des
+/// échantillons du groupe après leur écriture (inchangée en late-Z).
+static long long Graphics_RasterizeGroupMultisample(
+    Renderer *renderer, VShaderPlanes *planes, RasterTriangle *samples,
+    int gx, int gy, unsigned laneMask, unsigned coverageTests,
+    FragmentShader *fragShader, FShaderGlobals *fragGlobals, bool lateZ,
+    float *zmax, long long *culled)
+{
+    long long shaded = 0;
+    float zValues[RASTER_LANES][RASTER_MSAA_SAMPLES];
+    unsigned sampleMasks[RASTER_LANES] = { 0 };
+    unsigned covered = 0;
+    unsigned mask = 0;
+
+    // Les indices des pixels sont communs aux plans des échantillons
+    size_t indices[RASTER_LANES];
+    if (!lateZ)
+    {
+        Renderer_GetGroupIndices(renderer, gx, gy, laneMask, indices);
+    }
+
+    for (int s = 0; s < RASTER_MSAA_SAMPLES; ++s)
+    {
+        float depth[RASTER_LANES];
+        if (!lateZ)
+        {
+            Renderer_GetGroupSampleDepths(renderer, indices, s, depth);
+        }
+
+        float sampleZ[RASTER_LANES];
+        unsigned sampleCovered = 0;
+        unsigned pass = RasterTriangle_EvalGroup(
+            samples + s, gx, gy, laneMask, (coverageTests & (1u << s)) != 0,
+            lateZ ? NULL : depth, sampleZ, &sampleCovered);
+        covered |= sampleCovered;
+        mask |= pass;
+
+        for (int k = 0; k < RASTER_LANES; ++k)
+        {
+            zValues[k][s] = sampleZ[k];
+            sampleMasks[k] |= ((pass >> k) & 1u) << s;
+        }
+
+        if (zmax && !lateZ)
+        {
+            // Profondeurs de l'échantillon après leur écriture par Renderer_SetSamples()
+            *zmax = fmaxf(*zmax, RasterGroup_GetMaxDepth(laneMask, pass, sampleZ, depth));
+        }
+    }
+    *culled += Int_PopCount(covered & ~mask);
+
+    for (int q = 0; q < RASTER_LANES / 4; ++q)
+    {
+        unsigned quadMask = (mask >> (4 * q)) & 0xFu;
+        if (quadMask == 0)
+            continue;
+
+        Vec4 colors[4];
+        Graphics_ShadeQuad(
+            planes, gx + 2 * q, gy, quadMask, fragShader, fragGlobals, colors);
+
+        for (int k = 0; k < 4; ++k)
+        {
+            if ((quadMask & (1u << k)) == 0)
+                continue;
+
+            // Seuls les échantillons couverts (et visibles) reçoivent la couleur
+            int lane = 4 * q + k;
+            Renderer_SetSamples(
+                renderer, gx + RASTER_LANE_X(lane), gy + RASTER_LANE_Y(lane),
+                sampleMasks[lane], zValues[lane], colors[k], true);
+            shaded++;
+        }
+    }
+
+    return shaded;
+}
+
+/// @brief Calcule le rendu des pixels d'un groupe de RASTER_LANES pixels
+/// (aligné sur la grille des quads 2x2) couverts par un triangle.
+/// Le noyau de rastérisation fournit le masque des pixels couverts et visibles,
+/// seuls ces pixels sont ombrés, quad par quad (voir Graphics_ShadeQuad()).
+/// @param raster le triangle, ou en MSAA les RASTER_MSAA_SAMPLES triangles
+/// décalés de ses échantillons.
+/// @param sampleCount le nombre d'échantillons par pixel.
+/// @param gx, gy la position du premier pixel du groupe.
+/// @param laneMask le masque des pixels du groupe à traiter.
+/// @param coverageTests le masque des échantillons (bit 0 sans MSAA) dont la couverture
+/// est testée. Le bit d'un échantillon est nul si tous les pixels à traiter le couvrent,
+/// dans ce cas aucun test de couverture par pixel n'est effectué pour cet échantillon.
+/// @param lateZ true si le test de profondeur est effectué après le fragment shader.
+/// @param[in,out] zmax en MSAA et si non NULL, la profondeur maximale accumulée
+/// des échantillons (voir Graphics_RasterizeGroupMultisample()).
+/// @param[in,out] culled le nombre de pixels couverts rejetés par l'early-Z.
+/// @return Le nombre de pixels ombrés.
+static long long Graphics_RasterizeGroup(
+    Renderer *renderer, VShaderPlanes *planes, RasterTriangle *raster, int sampleCount,
+    int gx, int gy, unsigned laneMask, unsigned coverageTests,
+    FragmentShader *fragShader, FShaderGlobals *fragGlobals, bool lateZ,
+    GraphicsShadingCells *cells, float *zmax, long long *culled)
+{
+    if (sampleCount > 1)
+    {
+        return Graphics_RasterizeGroupMultisample(
+            renderer, planes, raster, gx, gy, laneMask, coverageTests,
+            fragShader, fragGlobals, lateZ, zmax, culled);
+    }
+
+    long long shaded = 0;
+    float zValues[RASTER_LANES];
+    float depth[RASTER_LANES];
+
+    for (int k = 0; k < RASTER_LANES; ++k)
+    {
+        depth[k] = (laneMask & (1u << k)) ?
+            Renderer_GetDepth(renderer, gx + RASTER_LANE_X(k), gy + RASTER_LANE_Y(k)) :
+            0.0f;
+    }
+
+    // Early-Z : le masque ne contient que les pixels couverts qui
+    // passent le test de profondeur
+    unsigned covered = 0;
+    unsigned mask = RasterTriangle_EvalGroup(
+        raster, gx, gy, laneMask, (coverageTests & 1u) != 0, lateZ ? NULL : depth,
+        zValues, &covered);
+    *culled += Int_PopCount(covered & ~mask);
+
+    if (cells->size > 1)
+    {
+        return Graphics_ShadeGroupCoarse(
+            renderer, planes, gx, gy, mask, zValues, fragShader, fragGlobals, cells);
+    }
+
+    for (int q = 0; q < RASTER_LANES / 4; ++q)
+    {
+        unsigned quadMask = (mask >> (4 * q)) & 0xFu;
+        if (quadMask == 0)
+        {
+            // Aucun pixel du quad n'appartient au triangle ou n'est visible
+            continue;
+        }
+
+        Vec4 colors[4];
+        Graphics_ShadeQuad(
+            planes, gx + 2 * q, gy, quadMask, fragShader, fragGlobals, colors);
+
+        for (int k = 0; k < 4; ++k)
+        {
+            if ((quadMask & (1u << k)) == 0)
+                continue;
+
+            // En late-Z, le test de profondeur est effectué ici
+            int lane = 4 * q + k;
+            Renderer_SetPixel(
+                renderer, gx + RASTER_LANE_X(lane), gy + RASTER_LANE_Y(lane),
+                zValues[lane], colors[k], true);
+            shaded++;
+        }
+    }
+
+    return shaded;
+}
+
+/// @brief Calcule le rendu des pixels d'un rectangle de l'écran couverts par un triangle.
+/// Le rectangle est parcouru par groupes de RASTER_LANES pixels alignés sur une
+/// grille de quads 2x2.
+/// @param raster le triangle, ou ses triangles décalés en MSAA (voir Graphics_RasterizeGroup()).
+/// @param coverageTests le masque des échantillons dont la couverture est testée, nul si
+/// le rectangle est entièrement couvert par le triangle (voir Graphics_RasterizeGroup()).
+/// @param lateZ true si le test de profondeur est effectué après le fragment shader.
+/// @param[in,out] zmax en MSAA et si non NULL, la profondeur maximale accumulée
+/// des échantillons du rectangle après leur écriture.
+/// @return Le nombre de pixels ombrés.
+static long long Graphics_RasterizeRect(
+    Renderer *renderer, VShaderPlanes *planes, RasterTriangle *raster, int sampleCount,
+    int xmin, int ymin, int xmax, int ymax, unsigned coverageTests,
+    FragmentShader *fragShader, FShaderGlobals *fragGlobals, bool lateZ, float *zmax)
+{
+    long long shaded = 0;
+    long long culled = 0;
+
+    if (Renderer_GetShadingMode(renderer) != RENDERER_SHADING_FULL && sampleCount == 1 &&
+        (xmin / RASTER_BLOCK_SIZE != xmax / RASTER_BLOCK_SIZE ||
+         ymin / RASTER_BLOCK_SIZE != ymax / RASTER_BLOCK_SIZE))
+    {
+        // Le taux d'ombrage est défini par bloc : le rectangle est traité bloc par bloc
+        for (int by = ymin - (ymin % RASTER_BLOCK_SIZE); by <= ymax; by += RASTER_BLOCK_SIZE)
+        {
+            for (int bx = xmin - (xmin % RASTER_BLOCK_SIZE); bx <= xmax; bx += RASTER_BLOCK_SIZE)
+            {
+                shaded += Graphics_RasterizeRect(
+                    renderer, planes, raster, sampleCount,
+                    Int_Max(bx, xmin), Int_Max(by, ymin),
+                    Int_Min(bx + RASTER_BLOCK_SIZE - 1, xmax), Int_Min(by + RASTER_BLOCK_SIZE - 1, ymax),
+                    coverageTests, fragShader, fragGlobals, lateZ, zmax);
+            }
+        }
+        return shaded;
+    }
+
+    GraphicsShadingCells cells;
+    Graphics_InitShadingCells(renderer, &cells, xmin, ymin, sampleCount);
+
+    int gx0 = xmin - (xmin % 2);
+    int gy0 = ymin - (ymin % 2);
+
+    for (int gy = gy0; gy <= ymax; gy += RASTER_GROUP_HEIGHT)
+    {
+        for (int gx = gx0; gx <= xmax; gx += RASTER_GROUP_WIDTH)
+        {
+            // Pixels du groupe appartenant au rectangle
+            unsigned laneMask = 0;
+            for (int k = 0; k < RASTER_LANES; ++k)
+            {
+                int x = gx + RASTER_LANE_X(k);
+                int y = gy + RASTER_LANE_Y(k);
+                if (x >= xmin && x <= xmax && y >= ymin && y <= ymax)
+                {
+                    laneMask |= 1u << k;
+                }
+            }
+
+            shaded += Graphics_RasterizeGroup(
+                renderer, planes, raster, sampleCount, gx, gy, laneMask, coverageTests,
+                fragShader, fragGlobals, lateZ, &cells, zmax, &culled);
+        }
+    }
+
+    RendererStats *stats = Renderer_GetThreadStats(renderer);
+    stats->fragmentsShaded += shaded;
+    stats->fragmentsCulled += culled;
+    stats->shadingInvocationsSaved += cells.saved;
+
+    return shaded;
+}
+
+/// @brief Calcule le rendu de la partie d'un petit triangle contenue dans un rectangle.
+/// Les centres couverts par le triangle sont connus depuis sa préparation :
+/// le groupe est traité par un seul appel au noyau, sans test de couverture
+/// (en MSAA, la couverture des échantillons reste testée).
+/// Le buffer de profondeur hiérarchique n'est pas mis à jour : il reste une
+/// borne supérieure valide et sera rafraîchi par le prochain grand triangle.
+/// @param lateZ true si le test de profondeur est effectué après le fragment shader.
+static void Graphics_RasterizeSmall(
+    Renderer *renderer, VShaderPlanes *planes, RasterTriangle *raster, int sampleCount,
+    int xmin, int ymin, int xmax, int ymax,
+    FragmentShader *fragShader, FShaderGlobals *fragGlobals, bool lateZ)
+{
+    int gx, gy;
+    RasterTriangle_GetSmallGroup(raster, &gx, &gy);
+
+    // Pixels couverts appartenant au rectangle
+    unsigned laneMask = 0;
+    for (int k = 0; k < RASTER_LANES; ++k)
+    {
+        int x = gx + RASTER_LANE_X(k);
+        int y = gy + RASTER_LANE_Y(k);
+        if (x >= xmin && x <= xmax && y >= ymin && y <= ymax)
+        {
+            laneMask |= 1u << k;
+        }
+    }
+    laneMask &= raster->smallMask;
+    if (laneMask == 0)
+        return;
+
+    // Le groupe utilise le taux d'ombrage du bloc de son premier pixel
+    GraphicsShadingCells cells;
+    Graphics_InitShadingCells(renderer, &cells, gx, gy, sampleCount);
+
+    long long culled = 0;
+    long long shaded = Graphics_RasterizeGroup(
+        renderer, planes, raster, sampleCount, gx, gy, laneMask,
+        (sampleCount > 1) ? (1u << sampleCount) - 1 : 0,
+        fragShader, fragGlobals, lateZ, &cells, NULL, &culled);
+
+    RendererStats *stats = Renderer_GetThreadStats(renderer);
+    stats->fragmentsShaded += shaded;
+    stats->fragmentsCulled += culled;
+    stats->shadingInvocationsSaved += cells.saved;
+}
+
+/// @brief Détermine la couverture d'un rectangle de pixels par un triangle
+/// (voir RasterTriangle_ClassifyRect()). En MSAA, le rectangle est entièrement
+/// couvert si tous ses échantillons le sont.
+/// @param raster le triangle, ou ses triangles décalés en MSAA.
+/// @param[out] coverageTests le masque des échantillons (bit 0 sans MSAA) qui ne
+/// couvrent pas tout le rectangle : seule leur couverture doit être testée par pixel.
+static RasterCoverage Graphics_ClassifyRect(
+    const RasterTriangle *raster, int sampleCount, int xmin, int ymin, int xmax, int ymax,
+    unsigned *coverageTests)
+{
+    bool none = true;
+    *coverageTests = 0;
+    for (int s = 0; s < sampleCount; ++s)
+    {
+        RasterCoverage coverage = RasterTriangle_ClassifyRect(raster + s, xmin, ymin, xmax, ymax);
+        none = none && (coverage == RASTER_COVERAGE_NONE);
+        if (coverage != RASTER_COVERAGE_FULL)
+        {
+            *coverageTests |= 1u << s;
+        }
+    }
+
+    if (none) return RASTER_COVERAGE_NONE;
+    return (*coverageTests == 0) ? RASTER_COVERAGE_FULL : RASTER_COVERAGE_PARTIAL;
+}
+
+/// @brief Renvoie une borne inférieure de la profondeur d'un triangle sur un
+/// rectangle de pixels (voir RasterTriangle_GetMinDepth()), valable pour tous
+/// les échantillons en MSAA.
+/// @param raster le triangle, ou ses triangles décalés en MSAA.
+static float Graphics_GetMinDepth(
+    const RasterTriangle *raster, int sampleCount, int xmin, int ymin, int xmax, int ymax)
+{
+    float zmin = RasterTriangle_GetMinDepth(raster, xmin, ymin, xmax, ymax);
+    for (int s = 1; s < sampleCount; ++s)
+    {
+        zmin = fminf(zmin, RasterTriangle_GetMinDepth(raster + s, xmin, ymin, xmax, ymax));
+    }
+    return zmin;
+}
+
+void Graphics_RasterizeTriangle(
+    Renderer *renderer, VShaderPlanes *planes, RasterTriangle *raster,
+    int xmin, int ymin, int xmax, int ymax,
+    FragmentShader *fragShader, FShaderGlobals *fragGlobals, bool lateZ)
+{
+    // Intersection de la boîte englobante et du rectangle
+    xmin = Int_Max(xmin, raster->xmin);
+    ymin = Int_Max(ymin, raster->ymin);
+    xmax = Int_Min(xmax, raster->xmax);
+    ymax = Int_Min(ymax, raster->ymax);
+
+    // En MSAA, chaque échantillon est rastérisé comme le centre des pixels
+    // d'un triangle décalé
+    int sampleCount = Renderer_GetSampleCount(renderer);
+    RasterTriangle sampleTriangles[RASTER_MSAA_SAMPLES];
+    RasterTriangle *samples = raster;
+    if (sampleCount > 1)
+    {
+        for (int s = 0; s < sampleCount; ++s)
+        {
+            RasterTriangle_GetSample(raster, s, sampleTriangles + s);
+        }
+        samples = sampleTriangles;
+    }
+
+    if (raster->small)
+    {
+        // Petit triangle : ni classification des blocs, ni test du buffer
+        // de profondeur hiérarchique, un seul appel au noyau
+        Graphics_RasterizeSmall(
+            renderer, planes, samples, sampleCount, xmin, ymin, xmax, ymax,
+            fragShader, fragGlobals, lateZ);
+        return;
+    }
+
+    if (!Renderer_GetHierarchical(renderer))
+    {
+        Graphics_RasterizeRect(
+            renderer, planes, samples, sampleCount, xmin, ymin, xmax, ymax,
+            (1u << sampleCount) - 1, fragShader, fragGlobals, lateZ, NULL);
+        return;
+    }
+
+    // Rastérisation hiérarchique : les blocs (alignés sur la grille de taille
+    // RASTER_BLOCK_SIZE) sont classés avant tout travail par pixel
+    RendererStats *stats = Renderer_GetThreadStats(renderer);
+    long long blocks[3] = { 0 };
+    long long occluded = 0;
+    int bx0 = xmin - (xmin % RASTER_BLOCK_SIZE);
+    int by0 = ymin - (ymin % RASTER_BLOCK_SIZE);
+
+    // Le buffer de profondeur hiérarchique n'est utilisé que si le fragment
+    // shader ne modifie pas la profondeur (early-Z)
+    bool hiZ = !lateZ;
+
+    // En MSAA, la profondeur maximale des blocs est obtenue pendant l'écriture des
+    // échantillons (les profondeurs UNORM16 sont arrondies : elles sont relues)
+    bool trackHiZ = hiZ && sampleCount > 1 &&
+        Renderer_GetDepthFormat(renderer) != RENDERER_DEPTH_UNORM16;
+    int width = Renderer_GetWidth(renderer);
+    int height = Renderer_GetHeight(renderer);
+
+    if (hiZ)
+    {
+        // Le triangle est rejeté s'il est derrière tous les blocs qu'il recouvre
+        float zmin = Graphics_GetMinDepth(samples, sampleCount, xmin, ymin, xmax, ymax);
+        bool hidden = true;
+        for (int by = by0; hidden && by <= ymax; by += RASTER_BLOCK_SIZE)
+        {
+            for (int bx = bx0; bx <= xmax; bx += RASTER_BLOCK_SIZE)
+            {
+                if (zmin <= Renderer_GetHiZ(
+                    renderer, bx / RASTER_BLOCK_SIZE, by / RASTER_BLOCK_SIZE))
+                {
+                    hidden = false;
+                    break;
+                }
+            }
+        }
+        if (hidden)
+        {
+            stats->trianglesOccluded++;
+            return;
+        }
+    }
+
+    for (int by = by0; by <= ymax; by += RASTER_BLOCK_SIZE)
+    {
+        int bymin = Int_Max(by, ymin);
+        int bymax = Int_Min(by + RASTER_BLOCK_SIZE - 1, ymax);
+
+        for (int bx = bx0; bx <= xmax; bx += RASTER_BLOCK_SIZE)
+        {
+            int bxmin = Int_Max(bx, xmin);
+            int bxmax = Int_Min(bx + RASTER_BLOCK_SIZE - 1, xmax);
+
+            unsigned coverageTests;
+            RasterCoverage coverage = Graphics_ClassifyRect(
+                samples, sampleCount, bxmin, bymin, bxmax, bymax, &coverageTests);
+            blocks[coverage]++;
+
+            if (coverage == RASTER_COVERAGE_NONE)
+                continue;
+
+            int hx = bx / RASTER_BLOCK_SIZE;
+            int hy = by / RASTER_BLOCK_SIZE;
+            if (hiZ && Graphics_GetMinDepth(samples, sampleCount, bxmin, bymin, bxmax, bymax) >
+                Renderer_GetHiZ(renderer, hx, hy))
+            {
+                // La partie du triangle contenue dans le bloc est cachée
+                occluded++;
+                continue;
+            }
+
+            // Si le rectangle couvre tout le bloc, la profondeur maximale de ses
+            // échantillons est obtenue pendant leur écriture, sans relire les
+            // RASTER_MSAA_SAMPLES plans
+            bool track = trackHiZ && bxmin == bx && bymin == by &&
+                bxmax == Int_Min(bx + RASTER_BLOCK_SIZE, width) - 1 &&
+                bymax == Int_Min(by + RASTER_BLOCK_SIZE, height) - 1;
+            float zmax = -INFINITY;
+
+            // En MSAA, seuls les échantillons qui ne couvrent pas tout le bloc
+            // sont soumis au test de couverture
+            long long shaded = Graphics_RasterizeRect(
+                renderer, planes, samples, sampleCount, bxmin, bymin, bxmax, bymax,
+                coverageTests, fragShader, fragGlobals, lateZ, track ? &zmax : NULL);
+
+            if (shaded > 0 && track)
+            {
+                Renderer_SetHiZ(renderer, hx, hy, zmax);
+            }
+            else if (shaded > 0 && !Renderer_GetPackedWrites(renderer))
+            {
+                // Le bloc est contenu dans la tuile du thread courant
+                // (avec les écritures regroupées, il est recalculé à la fin)
+                Renderer_UpdateHiZ(renderer, hx, hy);
+            }
+        }
+    }
+
+    stats->blocksOccluded += occluded;
+    stats->blocksRejected += blocks[RASTER_COVERAGE_NONE];
+    stats->blocksPartial += blocks[RASTER_COVERAGE_PARTIAL];
+    stats->blocksAccepted += blocks[RASTER_COVERAGE_FULL];
+}
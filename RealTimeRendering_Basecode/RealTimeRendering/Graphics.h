@@ -1,38 +1,173 @@
-#pragma once
-
-#include "Settings.h"
-#include "Renderer.h"
-#include "Vector.h"
-#include "Matrix.h"
-#include "Camera.h"
-#include "Mesh.h"
-#include "Material.h"
-#include "Scene.h"
-
-typedef struct VShaderGlobals_s VShaderGlobals;
-typedef struct VShaderIn_s      VShaderIn;
-typedef struct VShaderOut_s     VShaderOut;
-
-typedef struct FShaderGlobals_s FShaderGlobals;
-typedef struct FShaderIn_s      FShaderIn;
-
-typedef VShaderOut VertexShader(VShaderIn *in, VShaderGlobals *globals);
-typedef Vec4     FragmentShader(FShaderIn *in, FShaderGlobals *globals);
-
-/// @brief Calcule le rendu d'un objet.
-/// @param renderer le moteur de rendu 2D.
-/// @param object l'objet  rendre.
-/// @param vertShader le vertex shader.
-/// @param fragShader le fragement shader.
-void Graphics_RenderObject(
-    Renderer *renderer, Object *object,
-    VertexShader *vertShader, FragmentShader *fragShader);
-
-/// @brief Calcule le rendu d'un triangle.
-/// @param renderer le moteur de rendu 2D.
-/// @param vertices tableau contenant les trois sommets du triangle.
-/// @param fragShader le fragement shader.
-/// @param fragGlobals les donnes globales au triangle utilises par le fragment shader.
-void Graphics_RenderTriangle(
-    Renderer *renderer, VShaderOut *vertices,
-    FragmentShader *fragShader, FShaderGlobals *fragGlobals);
+#pragma once
+
+#include "Settings.h"
+#include "Renderer.h"
+#include "Vector.h"
+#include "Matrix.h"
+#include "Camera.h"
+#include "Mesh.h"
+#include "Material.h"
+#include "Scene.h"
+#include "Raster.h"
+
+typedef struct VShaderGlobals_s VShaderGlobals;
+typedef struct VShaderIn_s      VShaderIn;
+typedef struct VShaderOut_s     VShaderOut;
+typedef struct VShaderPlanes_s  VShaderPlanes;
+
+typedef struct FShaderGlobals_s FShaderGlobals;
+typedef struct FShaderIn_s      FShaderIn;
+
+typedef VShaderOut VertexShader(VShaderIn *in, VShaderGlobals *globals);
+typedef Vec4     FragmentShader(FShaderIn *in, FShaderGlobals *globals);
+
+/// @brief Demi-largeur maximale de la bande de garde en coordonnées normalisées.
+/// Un triangle qui dépasse de l'écran sans sortir de la bande de garde est
+/// rastérisé sans découpage : sa boîte englobante est limitée à l'écran.
+/// La bande est réduite pour les grandes images (voir Graphics_GetGuardBand()).
+#define GRAPHICS_GUARD_BAND 4.0f
+
+/// @brief Nombre maximal de sommets d'un triangle après découpage par le plan
+/// near et les quatre plans de la bande de garde.
+#define GRAPHICS_MAX_CLIP_VERTICES 8
+
+/// @brief Plans de découpage, utilisés comme bits des outcodes d'un sommet.
+/// Un bit est à 1 si le sommet est à l'extérieur du plan correspondant.
+typedef enum GraphicsClipPlane_e
+{
+    GRAPHICS_CLIP_LEFT   = 1 << 0,
+    GRAPHICS_CLIP_RIGHT  = 1 << 1,
+    GRAPHICS_CLIP_BOTTOM = 1 << 2,
+    GRAPHICS_CLIP_TOP    = 1 << 3,
+    GRAPHICS_CLIP_NEAR   = 1 << 4,
+    GRAPHICS_CLIP_FAR    = 1 << 5,
+
+    GRAPHICS_GUARD_LEFT   = 1 << 6,
+    GRAPHICS_GUARD_RIGHT  = 1 << 7,
+    GRAPHICS_GUARD_BOTTOM = 1 << 8,
+    GRAPHICS_GUARD_TOP    = 1 << 9,
+
+    /// @brief Plans du frustum.
+    GRAPHICS_CLIP_FRUSTUM =
+        GRAPHICS_CLIP_LEFT | GRAPHICS_CLIP_RIGHT | GRAPHICS_CLIP_BOTTOM |
+        GRAPHICS_CLIP_TOP | GRAPHICS_CLIP_NEAR | GRAPHICS_CLIP_FAR,
+
+    /// @brief Plans par lesquels un triangle est réellement découpé.
+    GRAPHICS_CLIP_GEOMETRIC =
+        GRAPHICS_CLIP_NEAR | GRAPHICS_GUARD_LEFT | GRAPHICS_GUARD_RIGHT |
+        GRAPHICS_GUARD_BOTTOM | GRAPHICS_GUARD_TOP,
+} GraphicsClipPlane;
+
+/// @brief Renvoie les demi-largeurs horizontale et verticale de la bande de garde
+/// en coordonnées normalisées pour le rectangle de projection du moteur de rendu.
+/// Elles valent au plus GRAPHICS_GUARD_BAND et sont réduites pour que les sommets
+/// à l'intérieur de la bande restent dans les coordonnées raster acceptées par
+/// RasterTriangle_Setup() (RASTER_MAX_COORD).
+/// @param renderer le moteur de rendu.
+/// @return Les demi-largeurs (au moins 1, le bord du rectangle de projection).
+Vec2 Graphics_GetGuardBand(Renderer *renderer);
+
+/// @brief Calcule l'outcode d'un sommet.
+/// @param clipPosH les coordonnées homogènes du sommet après la projection.
+/// @param reversedZ true si la projection est inversée (plans near z = w et far z = 0),
+/// false pour la projection standard (plans near z = -w et far z = w).
+/// @param guardBand les demi-largeurs de la bande de garde (voir Graphics_GetGuardBand()).
+/// @return Les plans (bits de GraphicsClipPlane) dont le sommet est à l'extérieur.
+int Graphics_ComputeOutcode(Vec4 clipPosH, bool reversedZ, Vec2 guardBand);
+
+/// @brief Découpe un triangle par des plans en coordonnées homogènes.
+/// Les sorties du vertex shader sont interpolées linéairement pour les
+/// nouveaux sommets, qui sont ensuite projetés.
+/// @param[in] vertices les trois sommets du triangle (non préparés).
+/// @param planes les plans de découpage (bits de GRAPHICS_CLIP_GEOMETRIC).
+/// @param reversedZ true si la projection est inversée (voir Graphics_ComputeOutcode()).
+/// @param guardBand les demi-largeurs de la bande de garde (voir Graphics_GetGuardBand()).
+/// @param[out] polygon les sommets du polygone obtenu
+/// (au plus GRAPHICS_MAX_CLIP_VERTICES).
+/// @return Le nombre de sommets du polygone, 0 s'il est entièrement découpé.
+int Graphics_ClipTriangle(
+    VShaderOut *vertices, int planes, bool reversedZ, Vec2 guardBand, VShaderOut *polygon);
+
+/// @brief Structure représentant une vue de la scène : une caméra et le rectangle
+/// de l'image dans lequel elle est rendue.
+typedef struct GraphicsView_s
+{
+    /// @brief La caméra de la vue. Ses proportions doivent correspondre
+    /// à celles du rectangle (voir Camera_SetAspectRatio()) et sa projection au
+    /// format de profondeur du moteur de rendu : les vues sont transmises à
+    /// Scene_SetDepthFormat() ou Camera_SetDepthRange() est appelée par l'appelant.
+    Camera *camera;
+
+    /// @brief Le rectangle de l'image (voir Renderer_SetViewport()).
+    SDL_Rect viewport;
+} GraphicsView;
+
+/// @brief Calcule le rendu d'un objet vu par la caméra de la scène.
+/// @param renderer le moteur de rendu 2D.
+/// @param object l'objet à rendre.
+/// @param vertShader le vertex shader.
+/// @param fragShader le fragement shader.
+/// @param lateZ true si le test de profondeur doit être effectué après le fragment shader
+/// (voir Graphics_RasterizeTriangle()).
+void Graphics_RenderObject(
+    Renderer *renderer, Object *object,
+    VertexShader *vertShader, FragmentShader *fragShader, bool lateZ);
+
+/// @brief Calcule le rendu d'un objet vu par plusieurs caméras.
+/// Le vertex shader n'est exécuté qu'une fois par sommet, avec la caméra de la
+/// première vue. Pour les vues suivantes, seules les sorties dépendant de la caméra
+/// (clipPos, clipPosH et invDepth) sont recalculées comme dans VertexShader_Base() :
+/// les autres sorties du vertex shader doivent être exprimées dans le repère monde.
+/// Le découpage, la répartition dans les tuiles et la rastérisation sont effectués
+/// pour chaque vue, dans son rectangle.
+/// @param renderer le moteur de rendu 2D.
+/// @param object l'objet à rendre.
+/// @param views les vues, dont les rectangles ne doivent pas se chevaucher.
+/// @param viewCount le nombre de vues.
+/// @param vertShader le vertex shader.
+/// @param fragShader le fragement shader.
+/// @param lateZ true si le test de profondeur doit être effectué après le fragment shader.
+void Graphics_RenderObjectViews(
+    Renderer *renderer, Object *object, GraphicsView *views, int viewCount,
+    VertexShader *vertShader, FragmentShader *fragShader, bool lateZ);
+
+/// @brief Calcule le rendu d'un triangle.
+/// @param renderer le moteur de rendu 2D.
+/// @param vertices tableau contenant les trois sommets du triangle.
+/// @param fragShader le fragement shader.
+/// @param fragGlobals les données globales au triangle utilisées par le fragment shader.
+/// @param lateZ true si le test de profondeur doit être effectué après le fragment shader.
+void Graphics_RenderTriangle(
+    Renderer *renderer, VShaderOut *vertices,
+    FragmentShader *fragShader, FShaderGlobals *fragGlobals, bool lateZ);
+
+/// @brief Prépare un triangle pour la rastérisation.
+/// Calcule les équations des arêtes et la boîte englobante du triangle, puis
+/// les équations de plan des sorties du vertex shader (interpolation correcte
+/// en perspective). Les gradients des attributs ne sont calculés qu'une fois
+/// par triangle.
+/// @param renderer le moteur de rendu 2D.
+/// @param[in] vertices tableau contenant les trois sommets du triangle.
+/// @param[out] raster le triangle préparé.
+/// @param[out] planes les équations de plan des sorties du vertex shader.
+/// @return false si le triangle n'a pas à être rastérisé.
+bool Graphics_SetupTriangle(
+    Renderer *renderer, VShaderOut *vertices, RasterTriangle *raster,
+    VShaderPlanes *planes);
+
+/// @brief Calcule le rendu de la partie d'un triangle préparé contenue dans un
+/// rectangle de l'écran (bornes incluses).
+/// Par défaut, le test de profondeur est effectué avant le fragment shader (early-Z) :
+/// seuls les pixels visibles sont ombrés. Un fragment shader qui rejette des pixels
+/// ou modifie leur profondeur doit être utilisé avec lateZ = true.
+/// @param renderer le moteur de rendu 2D.
+/// @param planes les équations de plan des sorties du vertex shader.
+/// @param raster le triangle préparé avec Graphics_SetupTriangle().
+/// @param xmin, ymin, xmax, ymax le rectangle de l'écran à rastériser.
+/// @param fragShader le fragement shader.
+/// @param fragGlobals les données globales au triangle utilisées par le fragment shader.
+/// @param lateZ true si le test de profondeur doit être effectué après le fragment shader.
+void Graphics_RasterizeTriangle(
+    Renderer *renderer, VShaderPlanes *planes, RasterTriangle *raster,
+    int xmin, int ymin, int xmax, int ymax,
+    FragmentShader *fragShader, FShaderGlobals *fragGlobals, bool lateZ);
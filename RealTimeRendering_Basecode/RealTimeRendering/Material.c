@@ -1,227 +1,326 @@
-#include "Mesh.h"
-#include "Material.h"
-#include "Vector.h"
-#include "Tools.h"
-
-Material *Material_LoadMTL(Mesh *mesh, char *path, char *fileName, int *count)
-{
-    char *fileBuffer = NULL;
-    char *curLine = NULL;
-    int lineCapacity = 64;
-    Material *materials = NULL;
-    int materialCount = 0;
-    int materialCapacity = 64;
-    char filePathBuffer[1024] = { 0 };
-
-    // D�finit le nombre de mat�riaux � 0 par s�curit�
-    *count = 0;
-
-    // Charge le fichier dans un buffer
-    long size = 0;
-    fileBuffer = Buffer_GetFromFile(path, fileName, &size);
-    if (!fileBuffer) { assert(false); goto ERROR_LABEL; }
-
-    // Alloue la ligne
-    curLine = (char *)calloc(lineCapacity, sizeof(char));
-    if (!curLine) goto ERROR_LABEL;
-
-    materials = (Material *)calloc(materialCapacity, sizeof(Material));
-    if (!materials) goto ERROR_LABEL;
-
-    // Parse le buffer
-    int offset = 0;
-    int lineNb = 0;
-    int index = -1;
-    do
-    {
-        int exitStatus = Buffer_ReadLine(fileBuffer, &offset, size, &curLine, &lineCapacity);
-        if (exitStatus == EXIT_FAILURE) goto ERROR_LABEL;
-
-        if (curLine[0] == '\0') continue;
-
-        lineNb++;
-
-        char *context = NULL;
-        char *word = strtok_s(curLine, " ", &context);
-
-        if (!word || strlen(word) < 1) continue;
-
-        if (strcmp(word, "newmtl") == 0)
-        {
-            word = strtok_s(NULL, " ", &context);
-            if (!word) continue;
-
-            materialCount++;
-            index++;
-            strcpy_s(materials[index].m_name, MATERIAL_NAME_SIZE, word);
-            printf("new material %s\n", materials[index].m_name);
-        }
-        else if (strcmp(word, "map_Ka") == 0 || strcmp(word, "map_Kd") == 0)
-        {
-            word = strtok_s(NULL, " ", &context);
-            if (!word) continue;
-
-            strcpy_s(filePathBuffer, 1024, path);
-            strcat_s(filePathBuffer, 1024, "/");
-            strcat_s(filePathBuffer, 1024, word);
-            if (materials[index].m_albedoMap != NULL) continue;
-
-            MeshTexture *texture = MeshTexture_Load(filePathBuffer);
-            if (!texture) goto ERROR_LABEL;
-            
-            materials[index].m_albedoMap = texture;
-        }
-        else if (strcmp(word, "map_Ks") == 0)
-        {
-            word = strtok_s(NULL, " ", &context);
-            if (!word) continue;
-
-            strcpy_s(filePathBuffer, 1024, path);
-            strcat_s(filePathBuffer, 1024, "/");
-            strcat_s(filePathBuffer, 1024, word);
-            if (materials[index].m_roughnessMap != NULL) continue;
-
-            MeshTexture *texture = MeshTexture_Load(filePathBuffer);
-            if (!texture) goto ERROR_LABEL;
-
-            materials[index].m_roughnessMap = texture;
-        }
-        else if (strcmp(word, "map_Nrm") == 0)
-        {
-            word = strtok_s(NULL, " ", &context);
-            if (!word) continue;
-
-            strcpy_s(filePathBuffer, 1024, path);
-            strcat_s(filePathBuffer, 1024, "/");
-            strcat_s(filePathBuffer, 1024, word);
-            if (materials[index].m_normalMap != NULL) continue;
-
-            MeshTexture *texture = MeshTexture_Load(filePathBuffer);
-            if (!texture) goto ERROR_LABEL;
-
-            materials[index].m_normalMap = texture;
-        }
-
-    } while (offset < size);
-
-    *count = materialCount;
-
-    return materials;
-
-ERROR_LABEL:
-    printf("ERROR - Material_LoadMTL()\n");
-    assert(false);
-    return NULL;
-}
-
-void Material_Free(Material *materials, int count)
-{
-    if (!materials) return;
-
-    for (int i = 0; i < count; ++i)
-    {
-        MeshTexture_Free(materials[i].m_albedoMap);
-        MeshTexture_Free(materials[i].m_normalMap);
-    }
-
-    free(materials);
-}
-
-MeshTexture *MeshTexture_Load(char *path)
-{
-    MeshTexture *texture = NULL;
-    SDL_Surface *surface = NULL;
-
-    texture = (MeshTexture *)calloc(1, sizeof(MeshTexture));
-    assert(texture);
-    if (!texture) goto ERROR_LABEL;
-
-    surface = IMG_Load(path);
-    assert(surface);
-    if (!surface) goto ERROR_LABEL;
-
-    // V�rification du format
-    SDL_PixelFormat *format = surface->format;
-    if (format->format != SDL_PIXELFORMAT_RGBA32)
-    {
-        SDL_PixelFormat *format = SDL_AllocFormat(SDL_PIXELFORMAT_RGBA32);
-        SDL_Surface *output = SDL_ConvertSurface(surface, format, 0);
-        SDL_FreeFormat(format);
-        SDL_FreeSurface(surface);
-
-        assert(output);
-        if (!output) goto ERROR_LABEL;
-
-        surface = output;
-    }
-    int pitch = surface->pitch;
-    int width = surface->w;
-    int height = surface->h;
-
-    texture->m_width = width;
-    texture->m_height = height;
-    texture->m_pixels = (Color **)calloc(width, sizeof(Color *));
-    if (!texture->m_pixels) goto ERROR_LABEL;
-
-    for (int x = 0; x < width; ++x)
-    {
-        texture->m_pixels[x] = (Color *)calloc(height, sizeof(Color));
-        if (!texture->m_pixels[x]) goto ERROR_LABEL;
-
-        for (int y = 0; y < height; ++y)
-        {
-            uint32_t *pixelRow = (uint32_t *)&((uint8_t *)surface->pixels)[y * pitch];
-            texture->m_pixels[x][y] = ((Color *)pixelRow)[x];
-        }
-    }
-
-    SDL_FreeSurface(surface);
-    surface = NULL;
-
-    return texture;
-
-ERROR_LABEL:
-    printf("ERROR - MeshTexture_Load()");
-    assert(false);
-    if (surface)
-    {
-        SDL_FreeSurface(surface);
-    }
-    return NULL;
-}
-
-void MeshTexture_Free(MeshTexture *meshTexture)
-{
-    if (!meshTexture) return;
-
-    if (meshTexture->m_pixels)
-    {
-        for (int x = 0; x < meshTexture->m_width; ++x)
-        {
-            free(meshTexture->m_pixels[x]);
-        }
-        free(meshTexture->m_pixels);
-    }
-
-    free(meshTexture);
-}
-
-Vec3 MeshTexture_GetColorVec3(MeshTexture *texture, Vec2 textUV)
-{
-    int textureW = texture->m_width;
-    int textureH = texture->m_height;
-
-    float u = textUV.x - floorf(textUV.x);
-    float v = textUV.y - floorf(textUV.y);
-    v = 1.0f - v;
-
-    int x = (int)(u * textureW);
-    int y = (int)(v * textureH);
-
-    x = Int_Clamp(x, 0, textureW - 1);
-    y = Int_Clamp(y, 0, textureH - 1);
-
-    Color color = texture->m_pixels[x][y];
-    return Vec3_Set(color.r / 255.f, color.g / 255.f, color.b / 255.f);
-}
-
+#include "Mesh.h"
+#include "Material.h"
+#include "Vector.h"
+#include "Tools.h"
+
+Material *Material_LoadMTL(Mesh *mesh, char *path, char *fileName, int *count)
+{
+    char *fileBuffer = NULL;
+    char *curLine = NULL;
+    int lineCapacity = 64;
+    Material *materials = NULL;
+    int materialCount = 0;
+    int materialCapacity = 64;
+    char filePathBuffer[1024] = { 0 };
+
+    // D�finit le nombre de mat�riaux � 0 par s�curit�
+    *count = 0;
+
+    // Charge le fichier dans un buffer
+    long size = 0;
+    fileBuffer = Buffer_GetFromFile(path, fileName, &size);
+    if (!fileBuffer) { assert(false); goto ERROR_LABEL; }
+
+    // Alloue la ligne
+    curLine = (char *)calloc(lineCapacity, sizeof(char));
+    if (!curLine) goto ERROR_LABEL;
+
+    materials = (Material *)calloc(materialCapacity, sizeof(Material));
+    if (!materials) goto ERROR_LABEL;
+
+    // Parse le buffer
+    int offset = 0;
+    int lineNb = 0;
+    int index = -1;
+    do
+    {
+        int exitStatus = Buffer_ReadLine(fileBuffer, &offset, size, &curLine, &lineCapacity);
+        if (exitStatus == EXIT_FAILURE) goto ERROR_LABEL;
+
+        if (curLine[0] == '\0') continue;
+
+        lineNb++;
+
+        char *context = NULL;
+        char *word = strtok_s(curLine, " ", &context);
+
+        if (!word || strlen(word) < 1) continue;
+
+        if (strcmp(word, "newmtl") == 0)
+        {
+            word = strtok_s(NULL, " ", &context);
+            if (!word) continue;
+
+            materialCount++;
+            index++;
+            strcpy_s(materials[index].m_name, MATERIAL_NAME_SIZE, word);
+            printf("new material %s\n", materials[index].m_name);
+        }
+        else if (strcmp(word, "map_Ka") == 0 || strcmp(word, "map_Kd") == 0)
+        {
+            word = strtok_s(NULL, " ", &context);
+            if (!word) continue;
+
+            strcpy_s(filePathBuffer, 1024, path);
+            strcat_s(filePathBuffer, 1024, "/");
+            strcat_s(filePathBuffer, 1024, word);
+            if (materials[index].m_albedoMap != NULL) continue;
+
+            MeshTexture *texture = MeshTexture_Load(filePathBuffer);
+            if (!texture) goto ERROR_LABEL;
+            
+            materials[index].m_albedoMap = texture;
+        }
+        else if (strcmp(word, "map_Ks") == 0)
+        {
+            word = strtok_s(NULL, " ", &context);
+            if (!word) continue;
+
+            strcpy_s(filePathBuffer, 1024, path);
+            strcat_s(filePathBuffer, 1024, "/");
+            strcat_s(filePathBuffer, 1024, word);
+            if (materials[index].m_roughnessMap != NULL) continue;
+
+            MeshTexture *texture = MeshTexture_Load(filePathBuffer);
+            if (!texture) goto ERROR_LABEL;
+
+            materials[index].m_roughnessMap = texture;
+        }
+        else if (strcmp(word, "map_Nrm") == 0)
+        {
+            word = strtok_s(NULL, " ", &context);
+            if (!word) continue;
+
+            strcpy_s(filePathBuffer, 1024, path);
+            strcat_s(filePathBuffer, 1024, "/");
+            strcat_s(filePathBuffer, 1024, word);
+            if (materials[index].m_normalMap != NULL) continue;
+
+            MeshTexture *texture = MeshTexture_Load(filePathBuffer);
+            if (!texture) goto ERROR_LABEL;
+
+            materials[index].m_normalMap = texture;
+        }
+
+    } while (offset < size);
+
+    *count = materialCount;
+
+    return materials;
+
+ERROR_LABEL:
+    printf("ERROR - Material_LoadMTL()\n");
+    assert(false);
+    return NULL;
+}
+
+void Material_Free(Material *materials, int count)
+{
+    if (!materials) return;
+
+    for (int i = 0; i < count; ++i)
+    {
+        MeshTexture_Free(materials[i].m_albedoMap);
+        MeshTexture_Free(materials[i].m_normalMap);
+    }
+
+    free(materials);
+}
+
+/// @brief Calcule les niveaux de mipmap d'une texture par moyenne de 2x2 texels.
+static int MeshTexture_BuildMipmaps(MeshTexture *texture)
+{
+    int levelCount = 0;
+    for (int size = Int_Max(texture->m_width, texture->m_height); size > 1; size >>= 1)
+    {
+        levelCount++;
+    }
+    if (levelCount == 0)
+        return EXIT_SUCCESS;
+
+    texture->m_levels = (MeshTexture *)calloc(levelCount, sizeof(MeshTexture));
+    if (!texture->m_levels) goto ERROR_LABEL;
+
+    texture->m_levelCount = levelCount;
+
+    MeshTexture *src = texture;
+    for (int i = 0; i < levelCount; ++i)
+    {
+        MeshTexture *dst = texture->m_levels + i;
+        int width = Int_Max(src->m_width / 2, 1);
+        int height = Int_Max(src->m_height / 2, 1);
+
+        dst->m_width = width;
+        dst->m_height = height;
+        dst->m_pixels = (Color **)calloc(width, sizeof(Color *));
+        if (!dst->m_pixels) goto ERROR_LABEL;
+
+        for (int x = 0; x < width; ++x)
+        {
+            dst->m_pixels[x] = (Color *)calloc(height, sizeof(Color));
+            if (!dst->m_pixels[x]) goto ERROR_LABEL;
+
+            int x0 = Int_Min(2 * x, src->m_width - 1);
+            int x1 = Int_Min(2 * x + 1, src->m_width - 1);
+            for (int y = 0; y < height; ++y)
+            {
+                int y0 = Int_Min(2 * y, src->m_height - 1);
+                int y1 = Int_Min(2 * y + 1, src->m_height - 1);
+                for (int c = 0; c < 4; ++c)
+                {
+                    int sum =
+                        src->m_pixels[x0][y0].data[c] + src->m_pixels[x1][y0].data[c] +
+                        src->m_pixels[x0][y1].data[c] + src->m_pixels[x1][y1].data[c];
+                    dst->m_pixels[x][y].data[c] = (Uint8)((sum + 2) / 4);
+                }
+            }
+        }
+
+        src = dst;
+    }
+
+    return EXIT_SUCCESS;
+
+ERROR_LABEL:
+    printf("ERROR - MeshTexture_BuildMipmaps()\n");
+    assert(false);
+    return EXIT_FAILURE;
+}
+
+MeshTexture *MeshTexture_Load(char *path)
+{
+    MeshTexture *texture = NULL;
+    SDL_Surface *surface = NULL;
+
+    texture = (MeshTexture *)calloc(1, sizeof(MeshTexture));
+    assert(texture);
+    if (!texture) goto ERROR_LABEL;
+
+    surface = IMG_Load(path);
+    assert(surface);
+    if (!surface) goto ERROR_LABEL;
+
+    // V�rification du format
+    SDL_PixelFormat *format = surface->format;
+    if (format->format != SDL_PIXELFORMAT_RGBA32)
+    {
+        SDL_PixelFormat *format = SDL_AllocFormat(SDL_PIXELFORMAT_RGBA32);
+        SDL_Surface *output = SDL_ConvertSurface(surface, format, 0);
+        SDL_FreeFormat(format);
+        SDL_FreeSurface(surface);
+
+        assert(output);
+        if (!output) goto ERROR_LABEL;
+
+        surface = output;
+    }
+    int pitch = surface->pitch;
+    int width = surface->w;
+    int height = surface->h;
+
+    texture->m_width = width;
+    texture->m_height = height;
+    texture->m_pixels = (Color **)calloc(width, sizeof(Color *));
+    if (!texture->m_pixels) goto ERROR_LABEL;
+
+    for (int x = 0; x < width; ++x)
+    {
+        texture->m_pixels[x] = (Color *)calloc(height, sizeof(Color));
+        if (!texture->m_pixels[x]) goto ERROR_LABEL;
+
+        for (int y = 0; y < height; ++y)
+        {
+            uint32_t *pixelRow = (uint32_t *)&((uint8_t *)surface->pixels)[y * pitch];
+            texture->m_pixels[x][y] = ((Color *)pixelRow)[x];
+        }
+    }
+
+    SDL_FreeSurface(surface);
+    surface = NULL;
+
+    int exitStatus = MeshTexture_BuildMipmaps(texture);
+    if (exitStatus != EXIT_SUCCESS) goto ERROR_LABEL;
+
+    return texture;
+
+ERROR_LABEL:
+    printf("ERROR - MeshTexture_Load()");
+    assert(false);
+    if (surface)
+    {
+        SDL_FreeSurface(surface);
+    }
+    return NULL;
+}
+
+/// @brief Libère les pixels d'une texture ou d'un niveau de mipmap.
+static void MeshTexture_FreePixels(MeshTexture *meshTexture)
+{
+    if (meshTexture->m_pixels)
+    {
+        for (int x = 0; x < meshTexture->m_width; ++x)
+        {
+            free(meshTexture->m_pixels[x]);
+        }
+        free(meshTexture->m_pixels);
+    }
+}
+
+void MeshTexture_Free(MeshTexture *meshTexture)
+{
+    if (!meshTexture) return;
+
+    MeshTexture_FreePixels(meshTexture);
+
+    if (meshTexture->m_levels)
+    {
+        for (int i = 0; i < meshTexture->m_levelCount; ++i)
+        {
+            MeshTexture_FreePixels(meshTexture->m_levels + i);
+        }
+        free(meshTexture->m_levels);
+    }
+
+    free(meshTexture);
+}
+
+Vec3 MeshTexture_GetColorVec3(MeshTexture *texture, Vec2 textUV)
+{
+    int textureW = texture->m_width;
+    int textureH = texture->m_height;
+
+    float u = textUV.x - floorf(textUV.x);
+    float v = textUV.y - floorf(textUV.y);
+    v = 1.0f - v;
+
+    int x = (int)(u * textureW);
+    int y = (int)(v * textureH);
+
+    x = Int_Clamp(x, 0, textureW - 1);
+    y = Int_Clamp(y, 0, textureH - 1);
+
+    Color color = texture->m_pixels[x][y];
+    return Vec3_Set(color.r / 255.f, color.g / 255.f, color.b / 255.f);
+}
+
+Vec3 MeshTexture_GetColorVec3Lod(MeshTexture *texture, Vec2 textUV, Vec2 ddx, Vec2 ddy)
+{
+    // Empreinte du pixel dans la texture (en texels au carré)
+    float w = (float)texture->m_width;
+    float h = (float)texture->m_height;
+    float lengthX = (ddx.x * w) * (ddx.x * w) + (ddx.y * h) * (ddx.y * h);
+    float lengthY = (ddy.x * w) * (ddy.x * w) + (ddy.y * h) * (ddy.y * h);
+    float rho2 = fmaxf(lengthX, lengthY);
+
+    // Niveau le plus proche de log2(empreinte), le niveau 0 en agrandissement
+    // (ou si les dérivées ne sont pas définies)
+    int level = 0;
+    if (rho2 > 1.0f)
+    {
+        float lod = 0.5f * log2f(rho2) + 0.5f;
+        level = (int)fminf(lod, (float)texture->m_levelCount);
+    }
+
+    MeshTexture *image = (level > 0) ? texture->m_levels + (level - 1) : texture;
+    return MeshTexture_GetColorVec3(image, textUV);
+}
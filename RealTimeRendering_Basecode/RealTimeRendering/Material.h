@@ -1,52 +1,66 @@
-#pragma once
-
-#include "Settings.h"
-#include "Mesh.h"
-
-#define MATERIAL_NAME_SIZE 128
-
-typedef union Color_s
-{
-    struct {
-        Uint8 r, g, b, a;
-    };
-    Uint8 data[4];
-} Color;
-
-typedef struct MeshTexture_s
-{
-    Color **m_pixels;
-    int m_width;
-    int m_height;
-} MeshTexture;
-
-MeshTexture *MeshTexture_Load(char *path);
-void MeshTexture_Free(MeshTexture *meshTexture);
-
-Vec3 MeshTexture_GetColorVec3(MeshTexture *meshTexture, Vec2 textUV);
-
-typedef struct Material_s
-{
-    char m_name[MATERIAL_NAME_SIZE];
-    MeshTexture *m_albedoMap;
-    MeshTexture *m_roughnessMap;
-    MeshTexture *m_normalMap;
-} Material;
-
-Material *Material_LoadMTL(Mesh *mesh, char *path, char *fileName, int *count);
-void Material_Free(Material *materials, int count);
-
-INLINE MeshTexture *Material_GetAlbedo(Material *material)
-{
-    return material->m_albedoMap;
-}
-
-INLINE MeshTexture *Material_GetRoughness(Material *material)
-{
-    return material->m_roughnessMap;
-}
-
-INLINE MeshTexture *Material_GetNormalMap(Material *material)
-{
-    return material->m_normalMap;
-}
+#pragma once
+
+#include "Settings.h"
+#include "Mesh.h"
+
+#define MATERIAL_NAME_SIZE 128
+
+typedef union Color_s
+{
+    struct {
+        Uint8 r, g, b, a;
+    };
+    Uint8 data[4];
+} Color;
+
+typedef struct MeshTexture_s
+{
+    Color **m_pixels;
+    int m_width;
+    int m_height;
+
+    /// @brief Niveaux de mipmap suivants, chacun deux fois plus petit que le
+    /// précédent (jusqu'à 1x1 pixel), ou NULL pour un niveau de mipmap.
+    struct MeshTexture_s *m_levels;
+    int m_levelCount;
+} MeshTexture;
+
+MeshTexture *MeshTexture_Load(char *path);
+void MeshTexture_Free(MeshTexture *meshTexture);
+
+Vec3 MeshTexture_GetColorVec3(MeshTexture *meshTexture, Vec2 textUV);
+
+/// @brief Renvoie la couleur d'une texture en choisissant le niveau de mipmap
+/// adapté à l'empreinte du pixel dans la texture.
+/// @param meshTexture la texture.
+/// @param textUV les coordonnées uv du pixel.
+/// @param ddx, ddy les dérivées des coordonnées uv selon x et selon y
+/// (voir FShaderIn).
+/// @return La couleur du texel le plus proche dans le niveau choisi.
+Vec3 MeshTexture_GetColorVec3Lod(MeshTexture *meshTexture, Vec2 textUV, Vec2 ddx, Vec2 ddy);
+
+typedef struct Material_s
+{
+    char m_name[MATERIAL_NAME_SIZE];
+    MeshTexture *m_albedoMap;
+    MeshTexture *m_roughnessMap;
+    MeshTexture *m_normalMap;
+} Material;
+
+Material *Material_LoadMTL(Mesh *mesh, char *path, char *fileName, int *count);
+void Material_Free(Material *materials, int count);
+
+INLINE MeshTexture *Material_GetAlbedo(Material *material)
+{
+    return material->m_albedoMap;
+}
+
+INLINE MeshTexture *Material_GetRoughness(Material *material)
+{
+    return material->m_roughnessMap;
+}
+
+INLINE MeshTexture *Material_GetNormalMap(Material *material)
+{
+    return material->m_normalMap;
+}
@@ -0,0 +1,255 @@
+#include "Raster.h"
+#include "Tools.h"
+
+/// @brief Initialise l'équation de l'arête allant de (x1, y1) à (x2, y2) (unités sous-pixel).
+static void RasterEdge_Setup(RasterEdge *edge, int x1, int y1, int x2, int y2)
+{
+    // E(p) = SignedArea(v1, v2, p)
+    edge->a = y1 - y2;
+    edge->b = x2 - x1;
+    edge->c = (long long)x1 * y2 - (long long)y1 * x2;
+
+    // Le repère raster a l'axe y vers le haut et le triangle est orienté
+    // dans le sens direct : une arête "gauche" descend (a > 0) et une arête
+    // "haute" est horizontale et parcourue vers la gauche (a == 0, b < 0).
+    // Les valeurs étant entières, E > 0 équivaut à E - 1 >= 0.
+    bool topLeft = (edge->a > 0) || (edge->a == 0 && edge->b < 0);
+    edge->bias = topLeft ? 0 : -1;
+    edge->c += edge->bias;
+}
+
+/// @brief Arrondit une coordonnée raster sur la grille sous-pixel.
+static int Raster_Snap(float value)
+{
+    return (int)lrintf(value * (float)RASTER_SUBPIXEL_STEP);
+}
+
+/// @brief Division entière arrondie vers moins l'infini.
+static int Raster_FloorDiv(int value, int divisor)
+{
+    int q = value / divisor;
+    return (q * divisor > value) ? q - 1 : q;
+}
+
+/// @brief Indique si le centre ou l'un des échantillons d'un pixel est couvert.
+static bool RasterTriangle_CoversPixel(const RasterTriangle *tri, int x, int y, int samples)
+{
+    for (int s = 0; s < samples; ++s)
+    {
+        bool inside = true;
+        for (int i = 0; inside && i < 3; ++i)
+        {
+            const RasterEdge *edge = tri->edges + i;
+            long long value = RasterEdge_Eval(edge, x, y);
+            if (samples > 1)
+            {
+                value += (long long)edge->a * g_rasterSampleOffsets[s][0];
+                value += (long long)edge->b * g_rasterSampleOffsets[s][1];
+            }
+            inside = RasterEdge_Inside(value);
+        }
+        if (inside)
+            return true;
+    }
+    return false;
+}
+
+bool RasterTriangle_Setup(
+    RasterTriangle *tri, Vec3 *vertices, int xmin, int ymin, int xmax, int ymax, int samples)
+{
+    tri->small = false;
+    tri->smallMask = 0;
+    tri->pixelArea = 0.0f;
+
+    // Positions en virgule fixe 28.4
+    int px[3], py[3];
+    for (int i = 0; i < 3; ++i)
+    {
+        if (!(fabsf(vertices[i].x) <= RASTER_MAX_COORD) ||
+            !(fabsf(vertices[i].y) <= RASTER_MAX_COORD))
+        {
+            // Sommet invalide : la bande de garde (voir Graphics_GetGuardBand())
+            // garantit que les sommets rastérisés sont dans ces limites
+            return false;
+        }
+        px[i] = Raster_Snap(vertices[i].x);
+        py[i] = Raster_Snap(vertices[i].y);
+        tri->z[i] = vertices[i].z;
+    }
+
+    long long area =
+        (long long)(px[1] - px[0]) * (py[2] - py[0]) -
+        (long long)(px[2] - px[0]) * (py[1] - py[0]);
+    tri->pixelArea = (float)area / (float)(2 * RASTER_SUBPIXEL_STEP * RASTER_SUBPIXEL_STEP);
+    if (area <= 0)
+    {
+        // Triangle vu de dos ou dégénéré après arrondi
+        return false;
+    }
+
+    RasterEdge_Setup(tri->edges + 0, px[1], py[1], px[2], py[2]);
+    RasterEdge_Setup(tri->edges + 1, px[2], py[2], px[0], py[0]);
+    RasterEdge_Setup(tri->edges + 2, px[0], py[0], px[1], py[1]);
+    tri->invArea = 1.0f / (float)area;
+
+    // Boîte englobante des centres de pixels (16 x + 8, 16 y + 8),
+    // élargie en MSAA aux pixels dont un échantillon peut être couvert
+    int margin = (samples > 1) ? RASTER_SAMPLE_MARGIN : 0;
+    int lowerX = Int_Min(px[0], Int_Min(px[1], px[2]));
+    int lowerY = Int_Min(py[0], Int_Min(py[1], py[2]));
+    int upperX = Int_Max(px[0], Int_Max(px[1], px[2]));
+    int upperY = Int_Max(py[0], Int_Max(py[1], py[2]));
+    const int half = RASTER_SUBPIXEL_STEP >> 1;
+    const int last = RASTER_SUBPIXEL_STEP - 1;
+
+    tri->xmin = Int_Max(Raster_FloorDiv(lowerX - half - margin + last, RASTER_SUBPIXEL_STEP), xmin);
+    tri->ymin = Int_Max(Raster_FloorDiv(lowerY - half - margin + last, RASTER_SUBPIXEL_STEP), ymin);
+    tri->xmax = Int_Min(Raster_FloorDiv(upperX - half + margin, RASTER_SUBPIXEL_STEP), xmax);
+    tri->ymax = Int_Min(Raster_FloorDiv(upperY - half + margin, RASTER_SUBPIXEL_STEP), ymax);
+    if (tri->xmin > tri->xmax || tri->ymin > tri->ymax)
+    {
+        return false;
+    }
+
+    // Petit triangle : les centres des pixels de son unique groupe sont testés
+    // directement, avant toute autre préparation
+    int gx, gy;
+    RasterTriangle_GetSmallGroup(tri, &gx, &gy);
+    tri->small =
+        (tri->xmax < gx + RASTER_GROUP_WIDTH) &&
+        (tri->ymax < gy + RASTER_GROUP_HEIGHT);
+    if (tri->small)
+    {
+        for (int k = 0; k < RASTER_LANES; ++k)
+        {
+            int x = gx + RASTER_LANE_X(k);
+            int y = gy + RASTER_LANE_Y(k);
+            if (x > tri->xmax || y > tri->ymax ||
+                x < tri->xmin || y < tri->ymin)
+                continue;
+
+            if (RasterTriangle_CoversPixel(tri, x, y, samples))
+            {
+                tri->smallMask |= 1u << k;
+            }
+        }
+        if (tri->smallMask == 0)
+        {
+            // Aucun centre de pixel (ou échantillon) n'est couvert
+            return false;
+        }
+    }
+
+    // Plans des coordonnées barycentriques : leurs gradients sont a / aire
+    // et b / aire, leur valeur exacte au premier pixel de la boîte englobante
+    // sert de référence
+    float scale = (float)RASTER_SUBPIXEL_STEP * tri->invArea;
+    float refX = tri->xmin + 0.5f;
+    float refY = tri->ymin + 0.5f;
+    for (int i = 0; i < 2; ++i)
+    {
+        const RasterEdge *edge = tri->edges + i;
+        RasterPlane *plane = tri->bary + i;
+        long long value = RasterEdge_Eval(edge, tri->xmin, tri->ymin) - edge->bias;
+
+        plane->dx = (float)edge->a * scale;
+        plane->dy = (float)edge->b * scale;
+        plane->c = (float)value * tri->invArea - plane->dx * refX - plane->dy * refY;
+    }
+
+    // Plan de la profondeur passant par les sommets arrondis,
+    // exprimé relativement au sommet 0 pour limiter les erreurs d'arrondi
+    const float step = 1.0f / (float)RASTER_SUBPIXEL_STEP;
+    float x1 = (px[1] - px[0]) * step, y1 = (py[1] - py[0]) * step;
+    float x2 = (px[2] - px[0]) * step, y2 = (py[2] - py[0]) * step;
+    float z1 = tri->z[1] - tri->z[0];
+    float z2 = tri->z[2] - tri->z[0];
+    float invAreaPixels = (float)(RASTER_SUBPIXEL_STEP * RASTER_SUBPIXEL_STEP) * tri->invArea;
+
+    tri->zPlane[0] = (z1 * y2 - z2 * y1) * invAreaPixels;
+    tri->zPlane[1] = (z2 * x1 - z1 * x2) * invAreaPixels;
+    tri->zPlane[2] = tri->z[0]
+        - tri->zPlane[0] * (px[0] * step)
+        - tri->zPlane[1] * (py[0] * step);
+    tri->zmin = fminf(tri->z[0], fminf(tri->z[1], tri->z[2]));
+    tri->zmax = fmaxf(tri->z[0], fmaxf(tri->z[1], tri->z[2]));
+    for (int k = 0; k < RASTER_LANES; ++k)
+    {
+        tri->zLaneOffsets[k] =
+            (float)RASTER_LANE_X(k) * tri->zPlane[0] +
+            (float)RASTER_LANE_Y(k) * tri->zPlane[1];
+    }
+
+    for (int i = 0; i < 3; ++i)
+    {
+        const RasterEdge *edge = tri->edges + i;
+        for (int k = 0; k < RASTER_LANES; ++k)
+        {
+            tri->laneOffsets[i][k] =
+                RASTER_LANE_X(k) * RASTER_SUBPIXEL_STEP * edge->a +
+                RASTER_LANE_Y(k) * RASTER_SUBPIXEL_STEP * edge->b;
+        }
+    }
+
+    return true;
+}
+
+void RasterTriangle_GetSample(const RasterTriangle *tri, int sample, RasterTriangle *sampleTri)
+{
+    int dx = g_rasterSampleOffsets[sample][0];
+    int dy = g_rasterSampleOffsets[sample][1];
+
+    *sampleTri = *tri;
+    for (int i = 0; i < 3; ++i)
+    {
+        const RasterEdge *edge = tri->edges + i;
+        sampleTri->edges[i].c += (long long)edge->a * dx + (long long)edge->b * dy;
+    }
+
+    const float step = 1.0f / (float)RASTER_SUBPIXEL_STEP;
+    sampleTri->zPlane[2] += tri->zPlane[0] * (dx * step) + tri->zPlane[1] * (dy * step);
+}
+
+float RasterTriangle_GetMinDepth(
+    const RasterTriangle *tri, int xmin, int ymin, int xmax, int ymax)
+{
+    // Coin du rectangle où le plan de la profondeur est minimal
+    float x = ((tri->zPlane[0] >= 0.0f) ? xmin : xmax) + 0.5f;
+    float y = ((tri->zPlane[1] >= 0.0f) ? ymin : ymax) + 0.5f;
+    float zmin = RasterTriangle_EvalDepth(tri, x, y);
+
+    // Erreur d'arrondi relative aux termes du plan (le noyau évalue le plan
+    // au premier pixel du groupe puis ajoute l'incrément du pixel)
+    float error = 4e-6f * (
+        fabsf(tri->zPlane[0] * x) + fabsf(tri->zPlane[1] * y) +
+        fabsf(tri->zPlane[2]) + fabsf(zmin));
+
+    // La profondeur calculée est limitée comme dans le noyau de rastérisation
+    return Float_Clamp(zmin - error, tri->zmin, tri->zmax);
+}
+
+RasterCoverage RasterTriangle_ClassifyRect(
+    const RasterTriangle *tri, int xmin, int ymin, int xmax, int ymax)
+{
+    bool full = true;
+
+    for (int i = 0; i < 3; ++i)
+    {
+        const RasterEdge *edge = tri->edges + i;
+
+        // Coins du rectangle où l'équation de l'arête est maximale et minimale
+        long long maxValue = RasterEdge_Eval(
+            edge, (edge->a >= 0) ? xmax : xmin, (edge->b >= 0) ? ymax : ymin);
+        long long minValue = RasterEdge_Eval(
+            edge, (edge->a >= 0) ? xmin : xmax, (edge->b >= 0) ? ymin : ymax);
+
+        if (!RasterEdge_Inside(maxValue))
+        {
+            // Tout le rectangle est à l'extérieur de cette arête
+            return RASTER_COVERAGE_NONE;
+        }
+        full = full && RasterEdge_Inside(minValue);
+    }
+
+    return full ? RASTER_COVERAGE_FULL : RASTER_COVERAGE_PARTIAL;
+}
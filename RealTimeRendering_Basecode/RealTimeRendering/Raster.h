@@ -0,0 +1,336 @@
+#pragma once
+
+/// @file Raster.h
+/// @defgroup Raster
+/// @{
+
+#include "Settings.h"
+#include "Vector.h"
+
+// Sélection à la compilation du noyau de rastérisation.
+// RASTER_FORCE_SCALAR impose la version scalaire, qui produit exactement
+// les mêmes résultats que les versions SIMD (à nombre de pixels égal).
+#if defined(RASTER_FORCE_SCALAR)
+#  define RASTER_KERNEL_SCALAR
+#elif defined(__AVX2__)
+#  define RASTER_KERNEL_AVX2
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#  define RASTER_KERNEL_SSE2
+#else
+#  define RASTER_KERNEL_SCALAR
+#endif
+
+/// @brief Nombre de pixels traités simultanément par le noyau de rastérisation.
+/// Les pixels sont regroupés en quads 2x2 : un groupe couvre 2 lignes
+/// de RASTER_GROUP_WIDTH pixels.
+#ifdef __AVX2__
+#  define RASTER_LANES 8
+#else
+#  define RASTER_LANES 4
+#endif
+
+/// @brief Largeur en pixels d'un groupe traité par le noyau de rastérisation.
+#define RASTER_GROUP_WIDTH (RASTER_LANES / 2)
+
+/// @brief Hauteur en pixels d'un groupe traité par le noyau de rastérisation.
+#define RASTER_GROUP_HEIGHT 2
+
+/// @brief Décalage horizontal du pixel k dans son groupe.
+/// Les pixels sont rangés quad par quad : (0,0) (1,0) (0,1) (1,1) puis le quad suivant.
+#define RASTER_LANE_X(k) ((((k) >> 2) << 1) | ((k) & 1))
+
+/// @brief Décalage vertical du pixel k dans son groupe.
+#define RASTER_LANE_Y(k) (((k) >> 1) & 1)
+
+/// @brief Nombre de bits de la partie fractionnaire des positions raster.
+/// Les sommets sont arrondis sur une grille de 1/16 de pixel (virgule fixe 28.4).
+#define RASTER_SUBPIXEL_BITS 4
+
+/// @brief Nombre de positions sous-pixel par pixel.
+#define RASTER_SUBPIXEL_STEP (1 << RASTER_SUBPIXEL_BITS)
+
+/// @brief Valeur absolue maximale d'une coordonnée raster (en pixels).
+/// Elle garantit que les coefficients a et b des arêtes sont inférieurs à 2^19
+/// et que les incréments entre les pixels d'un groupe sont au plus 2^25.
+/// La bande de garde est réduite pour que les sommets rastérisés respectent
+/// cette limite (voir Graphics_GetGuardBand()), qui borne aussi la taille des images.
+#define RASTER_MAX_COORD 16384.0f
+
+/// @brief Borne de saturation des équations d'arête évaluées sur 32 bits.
+#define RASTER_EDGE_SATURATION (1 << 30)
+
+/// @brief Nombre d'échantillons par pixel en mode multi-échantillonnage (MSAA).
+#define RASTER_MSAA_SAMPLES 4
+
+/// @brief Distance maximale (en unités sous-pixel, selon x ou y) entre un
+/// échantillon et le centre de son pixel.
+#define RASTER_SAMPLE_MARGIN 6
+
+/// @brief Positions des échantillons du MSAA relativement au centre du pixel
+/// (unités sous-pixel, axe y vers le haut). La grille est tournée : les quatre
+/// échantillons ont des abscisses et des ordonnées distinctes, ce qui améliore
+/// le rendu des arêtes presque horizontales ou verticales.
+static const int g_rasterSampleOffsets[RASTER_MSAA_SAMPLES][2] = {
+    { -2, -6 }, { 6, -2 }, { -6, 2 }, { 2, 6 }
+};
+
+/// @brief Equation affine d'une arête d'un triangle : E(X, Y) = a * X + b * Y + c,
+/// où X et Y sont les coordonnées en virgule fixe (unités sous-pixel).
+/// E est positive à l'intérieur du triangle (orienté dans le sens direct)
+/// et vaut le double de l'aire du triangle formé par l'arête et le point (X, Y).
+/// Tous les calculs sont entiers et donc exacts : deux triangles partageant
+/// une arête se partagent exactement les pixels situés de part et d'autre.
+typedef struct RasterEdge_s
+{
+    int a;
+    int b;
+
+    /// @brief Terme constant, biais de la règle top-left inclus.
+    /// La valeur biaisée E + bias est positive ou nulle si et seulement si
+    /// le point est couvert.
+    long long c;
+
+    /// @brief Biais de la règle top-left : 0 pour une arête "haute" ou "gauche", -1 sinon.
+    /// Un pixel dont le centre est exactement sur l'arête n'est dessiné
+    /// que si l'arête vérifie cette règle (top-left fill rule).
+    int bias;
+} RasterEdge;
+
+/// @brief Equation de plan d'un attribut interpolé dans le repère raster :
+/// v(x, y) = dx * x + dy * y + c, évaluée au centre des pixels.
+typedef struct RasterPlane_s
+{
+    /// @brief Gradients de l'attribut selon x et selon y (par pixel).
+    float dx, dy;
+
+    /// @brief Valeur de l'attribut à l'origine du repère raster.
+    float c;
+} RasterPlane;
+
+/// @brief Structure représentant un triangle préparé pour la rastérisation.
+/// Les équations des arêtes sont calculées une seule fois par triangle
+/// puis évaluées de manière incrémentale pixel par pixel.
+typedef struct RasterTriangle_s
+{
+    /// @brief Equations des arêtes.
+    /// L'arête i est opposée au sommet i, donc edges[i] / aire donne
+    /// la i-ème coordonnée barycentrique (voir RasterTriangle_GetPlane()).
+    RasterEdge edges[3];
+
+    /// @brief Inverse du double de l'aire du triangle (en unités sous-pixel).
+    float invArea;
+
+    /// @brief Plans des deux premières coordonnées barycentriques.
+    /// Ils permettent de calculer le plan de n'importe quel attribut
+    /// (voir RasterTriangle_GetPlane()).
+    RasterPlane bary[2];
+
+    /// @brief Profondeur (z en clip space) des trois sommets.
+    float z[3];
+
+    /// @brief Plan de la profondeur dans le repère raster :
+    /// z(x, y) = zPlane[0] * x + zPlane[1] * y + zPlane[2].
+    float zPlane[3];
+
+    /// @brief Profondeurs minimale et maximale du triangle.
+    /// La profondeur interpolée est limitée à cet intervalle.
+    float zmin, zmax;
+
+    /// @brief Incréments des équations d'arête entre le premier pixel
+    /// d'un groupe et chacun de ses RASTER_LANES pixels.
+    int laneOffsets[3][RASTER_LANES];
+
+    /// @brief Incréments de la profondeur entre le premier pixel d'un groupe
+    /// et chacun de ses RASTER_LANES pixels.
+    float zLaneOffsets[RASTER_LANES];
+
+    /// @brief Boîte englobante (inclusive) des pixels potentiellement couverts.
+    int xmin, xmax;
+    int ymin, ymax;
+
+    /// @brief Aire du triangle en pixels (négative si le triangle est vu de dos).
+    float pixelArea;
+
+    /// @brief Indique si la boîte englobante tient dans un seul groupe de pixels
+    /// (voir RasterTriangle_GetSmallGroup()). Un tel triangle est rastérisé
+    /// par un unique appel au noyau, sans classification des blocs.
+    bool small;
+
+    /// @brief Masque des pixels du groupe dont le centre (ou, en MSAA, au moins
+    /// un échantillon) est couvert par un petit triangle.
+    unsigned smallMask;
+} RasterTriangle;
+
+/// @brief Couverture d'un bloc de pixels par un triangle.
+typedef enum RasterCoverage_e
+{
+    /// @brief Aucun centre de pixel du bloc n'est couvert (rejet trivial).
+    RASTER_COVERAGE_NONE,
+
+    /// @brief Le bloc est partiellement couvert, un test par pixel est nécessaire.
+    RASTER_COVERAGE_PARTIAL,
+
+    /// @brief Tous les centres de pixel du bloc sont couverts (acceptation triviale).
+    RASTER_COVERAGE_FULL,
+} RasterCoverage;
+
+/// @brief Taille en pixels (largeur et hauteur) d'un bloc de la rastérisation hiérarchique.
+#define RASTER_BLOCK_SIZE 8
+
+/// @brief Prépare un triangle pour la rastérisation.
+/// @param[out] tri le triangle à initialiser.
+/// @param[in] vertices les trois sommets du triangle dans le repère raster,
+/// la composante z contient la profondeur utilisée pour le test du z-buffer.
+/// Les positions x et y sont arrondies au 1/16 de pixel le plus proche.
+/// @param xmin, ymin, xmax, ymax le rectangle de rendu en pixels (bornes incluses),
+/// qui limite la boîte englobante du triangle.
+/// @param samples le nombre d'échantillons par pixel (1 ou RASTER_MSAA_SAMPLES).
+/// En MSAA, la boîte englobante contient tous les pixels dont un échantillon
+/// peut être couvert.
+/// Le centre des pixels d'un petit triangle est testé avant le calcul
+/// du plan de la profondeur : un petit triangle qui ne couvre aucun centre
+/// de pixel est rejeté avec small == true et smallMask == 0.
+/// @return false si le triangle est vu de dos, dégénéré ou ne couvre aucun pixel.
+bool RasterTriangle_Setup(
+    RasterTriangle *tri, Vec3 *vertices, int xmin, int ymin, int xmax, int ymax, int samples);
+
+/// @brief Calcule le triangle dont la rastérisation aux centres des pixels
+/// donne la couverture et la profondeur de l'échantillon d'indice sample.
+/// Les équations d'arête sont décalées de manière exacte : la couverture
+/// de chaque échantillon respecte la règle top-left.
+/// @param[in] tri le triangle préparé avec RasterTriangle_Setup().
+/// @param sample l'indice de l'échantillon (voir g_rasterSampleOffsets).
+/// @param[out] sampleTri le triangle décalé.
+void RasterTriangle_GetSample(const RasterTriangle *tri, int sample, RasterTriangle *sampleTri);
+
+/// @brief Détermine la couverture d'un rectangle de pixels par un triangle.
+/// Les équations d'arête étant affines, il suffit de les évaluer aux centres
+/// des pixels situés aux coins du rectangle.
+/// @param tri le triangle.
+/// @param xmin, ymin, xmax, ymax le rectangle de pixels (bornes incluses).
+/// @return La couverture du rectangle.
+RasterCoverage RasterTriangle_ClassifyRect(
+    const RasterTriangle *tri, int xmin, int ymin, int xmax, int ymax);
+
+/// @brief Renvoie une borne inférieure de la profondeur d'un triangle sur un
+/// rectangle de pixels. La borne est diminuée de l'erreur d'arrondi possible
+/// de l'évaluation du plan de la profondeur, elle est donc valide pour les
+/// profondeurs calculées par RasterTriangle_EvalGroup().
+/// @param tri le triangle.
+/// @param xmin, ymin, xmax, ymax le rectangle de pixels (bornes incluses).
+/// @return La profondeur minimale du triangle sur le rectangle.
+float RasterTriangle_GetMinDepth(
+    const RasterTriangle *tri, int xmin, int ymin, int xmax, int ymax);
+
+/// @brief Calcule l'équation de plan d'un attribut à partir de ses valeurs aux
+/// trois sommets d'un triangle préparé avec RasterTriangle_Setup().
+/// Le plan passe par les sommets arrondis sur la grille sous-pixel.
+/// @param tri le triangle.
+/// @param v0, v1, v2 les valeurs de l'attribut aux sommets.
+/// @return L'équation de plan de l'attribut.
+INLINE RasterPlane RasterTriangle_GetPlane(
+    const RasterTriangle *tri, float v0, float v1, float v2)
+{
+    // v = v2 + w0 * (v0 - v2) + w1 * (v1 - v2)
+    float d0 = v0 - v2;
+    float d1 = v1 - v2;
+    RasterPlane plane;
+    plane.dx = tri->bary[0].dx * d0 + tri->bary[1].dx * d1;
+    plane.dy = tri->bary[0].dy * d0 + tri->bary[1].dy * d1;
+    plane.c = v2 + tri->bary[0].c * d0 + tri->bary[1].c * d1;
+    return plane;
+}
+
+/// @brief Noyau de rastérisation : évalue la couverture, interpole la profondeur
+/// et effectue le test de profondeur d'un groupe de RASTER_LANES pixels.
+/// La couverture est calculée en entiers 32 bits.
+/// La profondeur est évaluée avec le plan zPlane puis limitée à [zmin, zmax].
+/// Selon la compilation, le groupe est traité en AVX2, en SSE2 ou en scalaire.
+/// @param tri le triangle.
+/// @param x, y la position du premier pixel du groupe (coin bas gauche).
+/// @param laneMask le masque des pixels du groupe à traiter (bit k pour le pixel k).
+/// @param coverageTest false si tous les pixels à traiter sont couverts par le triangle.
+/// @param[in] depth les valeurs du z-buffer des pixels du groupe,
+/// ou NULL pour ne pas effectuer le test de profondeur.
+/// @param[out] zValues les profondeurs interpolées des pixels du groupe.
+/// @param[out] covered le masque des pixels couverts, avant le test de profondeur.
+/// @return Le masque des pixels couverts dont la profondeur passe le test.
+unsigned RasterTriangle_EvalGroup(
+    const RasterTriangle *tri, int x, int y, unsigned laneMask, bool coverageTest,
+    const float *depth, float *zValues, unsigned *covered);
+
+/// @brief Renvoie la profondeur maximale des pixels d'un groupe une fois écrits
+/// les pixels qui passent le test de profondeur (voir RasterTriangle_EvalGroup()) :
+/// un pixel du masque pass prend sa profondeur interpolée, les autres gardent
+/// celle du z-buffer. Traité en AVX2, en SSE2 ou en scalaire comme le noyau.
+/// @param laneMask le masque des pixels du groupe à considérer.
+/// @param pass le masque des pixels écrits, contenu dans laneMask.
+/// @param[in] zValues les profondeurs interpolées des pixels du groupe.
+/// @param[in] depth les valeurs du z-buffer des pixels du groupe avant l'écriture.
+/// @return La profondeur maximale des pixels de laneMask, -INFINITY si le masque est vide.
+float RasterGroup_GetMaxDepth(
+    unsigned laneMask, unsigned pass, const float *zValues, const float *depth);
+
+/// @brief Evalue l'équation (biaisée) d'une arête au centre d'un pixel.
+/// @param edge l'arête.
+/// @param x l'abscisse du pixel.
+/// @param y l'ordonnée du pixel.
+/// @return La valeur exacte E + bias de l'équation au centre du pixel (x, y).
+INLINE long long RasterEdge_Eval(const RasterEdge *edge, int x, int y)
+{
+    long long px = ((long long)x << RASTER_SUBPIXEL_BITS) + (RASTER_SUBPIXEL_STEP >> 1);
+    long long py = ((long long)y << RASTER_SUBPIXEL_BITS) + (RASTER_SUBPIXEL_STEP >> 1);
+    return edge->a * px + edge->b * py + edge->c;
+}
+
+/// @brief Limite la valeur d'une équation d'arête à l'intervalle représentable
+/// sur 32 bits par le noyau. Les incréments d'un groupe étant au plus 2^25,
+/// le signe des valeurs limitées est celui des valeurs exactes.
+/// @param value la valeur exacte de l'équation.
+/// @return La valeur limitée à [-RASTER_EDGE_SATURATION, RASTER_EDGE_SATURATION].
+INLINE int RasterEdge_Saturate(long long value)
+{
+    if (value > RASTER_EDGE_SATURATION) return RASTER_EDGE_SATURATION;
+    if (value < -RASTER_EDGE_SATURATION) return -RASTER_EDGE_SATURATION;
+    return (int)value;
+}
+
+/// @brief Renvoie la position du groupe de pixels contenant la boîte englobante
+/// d'un petit triangle (coin bas gauche aligné sur la grille des quads 2x2).
+/// @param tri le triangle.
+/// @param[out] x, y la position du premier pixel du groupe.
+INLINE void RasterTriangle_GetSmallGroup(const RasterTriangle *tri, int *x, int *y)
+{
+    *x = tri->xmin - (tri->xmin % 2);
+    *y = tri->ymin - (tri->ymin % 2);
+}
+
+/// @brief Evalue le plan de la profondeur d'un triangle en un point.
+/// @param tri le triangle.
+/// @param x l'abscisse du point.
+/// @param y l'ordonnée du point.
+/// @return La profondeur (non limitée) du plan du triangle au point (x, y).
+INLINE float RasterTriangle_EvalDepth(const RasterTriangle *tri, float x, float y)
+{
+    return tri->zPlane[0] * x + tri->zPlane[1] * y + tri->zPlane[2];
+}
+
+/// @brief Evalue l'équation de plan d'un attribut en un point.
+/// @param plane le plan.
+/// @param x l'abscisse du point.
+/// @param y l'ordonnée du point.
+/// @return La valeur de l'attribut au point (x, y).
+INLINE float RasterPlane_Eval(const RasterPlane *plane, float x, float y)
+{
+    return plane->dx * x + plane->dy * y + plane->c;
+}
+
+/// @brief Indique si un point est du côté intérieur d'une arête.
+/// @param value la valeur biaisée de l'équation de l'arête au point.
+/// @return true si le point est couvert d'après la règle top-left.
+INLINE bool RasterEdge_Inside(long long value)
+{
+    return value >= 0;
+}
+
+/// @}
@@ -0,0 +1,189 @@
+#include "Raster.h"
+#include "Tools.h"
+
+#if defined(RASTER_KERNEL_AVX2) || defined(RASTER_KERNEL_SSE2)
+#  include <immintrin.h>
+#endif
+
+// Les trois versions du noyau effectuent exactement les mêmes opérations
+// entières et flottantes dans le même ordre (sans FMA) : leurs résultats
+// sont identiques. La valeur d'une équation d'arête en un pixel est sa valeur
+// exacte (64 bits) au premier pixel du groupe plus l'incrément entier du pixel.
+// La couverture est testée sur 32 bits à partir de la valeur limitée
+// par RasterEdge_Saturate() : le pixel est couvert si le bit de signe
+// des trois valeurs biaisées est nul.
+
+#if defined(RASTER_KERNEL_AVX2)
+
+unsigned RasterTriangle_EvalGroup(
+    const RasterTriangle *tri, int x, int y, unsigned laneMask, bool coverageTest,
+    const float *depth, float *zValues, unsigned *covered)
+{
+    __m256i signs = _mm256_setzero_si256();
+
+    for (int i = 0; coverageTest && i < 3; ++i)
+    {
+        long long value = RasterEdge_Eval(tri->edges + i, x, y);
+        __m256i e = _mm256_add_epi32(
+            _mm256_set1_epi32(RasterEdge_Saturate(value)),
+            _mm256_loadu_si256((const __m256i *)tri->laneOffsets[i]));
+        signs = _mm256_or_si256(signs, e);
+    }
+
+    float px = x + 0.5f;
+    float py = y + 0.5f;
+    __m256 z = _mm256_add_ps(
+        _mm256_set1_ps(RasterTriangle_EvalDepth(tri, px, py)),
+        _mm256_loadu_ps(tri->zLaneOffsets));
+    z = _mm256_min_ps(z, _mm256_set1_ps(tri->zmax));
+    z = _mm256_max_ps(z, _mm256_set1_ps(tri->zmin));
+    _mm256_storeu_ps(zValues, z);
+
+    unsigned inside = ~(unsigned)_mm256_movemask_ps(_mm256_castsi256_ps(signs));
+    *covered = inside & laneMask;
+    if (!depth)
+    {
+        return *covered;
+    }
+
+    __m256 pass = _mm256_cmp_ps(z, _mm256_loadu_ps(depth), _CMP_LE_OQ);
+
+    return (unsigned)_mm256_movemask_ps(pass) & *covered;
+}
+
+float RasterGroup_GetMaxDepth(
+    unsigned laneMask, unsigned pass, const float *zValues, const float *depth)
+{
+    // Masques des pixels sous forme de vecteurs
+    const __m256i bits = _mm256_setr_epi32(1, 2, 4, 8, 16, 32, 64, 128);
+    __m256 written = _mm256_castsi256_ps(_mm256_cmpeq_epi32(
+        _mm256_and_si256(_mm256_set1_epi32((int)pass), bits), bits));
+    __m256 lanes = _mm256_castsi256_ps(_mm256_cmpeq_epi32(
+        _mm256_and_si256(_mm256_set1_epi32((int)laneMask), bits), bits));
+
+    __m256 z = _mm256_blendv_ps(_mm256_loadu_ps(depth), _mm256_loadu_ps(zValues), written);
+    z = _mm256_blendv_ps(_mm256_set1_ps(-INFINITY), z, lanes);
+
+    __m128 m = _mm_max_ps(_mm256_castps256_ps128(z), _mm256_extractf128_ps(z, 1));
+    m = _mm_max_ps(m, _mm_movehl_ps(m, m));
+    m = _mm_max_ss(m, _mm_shuffle_ps(m, m, 1));
+    return _mm_cvtss_f32(m);
+}
+
+#elif defined(RASTER_KERNEL_SSE2)
+
+unsigned RasterTriangle_EvalGroup(
+    const RasterTriangle *tri, int x, int y, unsigned laneMask, bool coverageTest,
+    const float *depth, float *zValues, unsigned *covered)
+{
+    __m128i signs = _mm_setzero_si128();
+
+    for (int i = 0; coverageTest && i < 3; ++i)
+    {
+        long long value = RasterEdge_Eval(tri->edges + i, x, y);
+        __m128i e = _mm_add_epi32(
+            _mm_set1_epi32(RasterEdge_Saturate(value)),
+            _mm_loadu_si128((const __m128i *)tri->laneOffsets[i]));
+        signs = _mm_or_si128(signs, e);
+    }
+
+    float px = x + 0.5f;
+    float py = y + 0.5f;
+    __m128 z = _mm_add_ps(
+        _mm_set1_ps(RasterTriangle_EvalDepth(tri, px, py)),
+        _mm_loadu_ps(tri->zLaneOffsets));
+    z = _mm_min_ps(z, _mm_set1_ps(tri->zmax));
+    z = _mm_max_ps(z, _mm_set1_ps(tri->zmin));
+    _mm_storeu_ps(zValues, z);
+
+    unsigned inside = ~(unsigned)_mm_movemask_ps(_mm_castsi128_ps(signs));
+    *covered = inside & laneMask;
+    if (!depth)
+    {
+        return *covered;
+    }
+
+    __m128 pass = _mm_cmple_ps(z, _mm_loadu_ps(depth));
+
+    return (unsigned)_mm_movemask_ps(pass) & *covered;
+}
+
+float RasterGroup_GetMaxDepth(
+    unsigned laneMask, unsigned pass, const float *zValues, const float *depth)
+{
+    // Masques des pixels sous forme de vecteurs
+    const __m128i bits = _mm_setr_epi32(1, 2, 4, 8);
+    __m128 written = _mm_castsi128_ps(_mm_cmpeq_epi32(
+        _mm_and_si128(_mm_set1_epi32((int)pass), bits), bits));
+    __m128 lanes = _mm_castsi128_ps(_mm_cmpeq_epi32(
+        _mm_and_si128(_mm_set1_epi32((int)laneMask), bits), bits));
+
+    __m128 z = _mm_or_ps(
+        _mm_and_ps(written, _mm_loadu_ps(zValues)),
+        _mm_andnot_ps(written, _mm_loadu_ps(depth)));
+    z = _mm_or_ps(_mm_and_ps(lanes, z), _mm_andnot_ps(lanes, _mm_set1_ps(-INFINITY)));
+
+    __m128 m = _mm_max_ps(z, _mm_movehl_ps(z, z));
+    m = _mm_max_ss(m, _mm_shuffle_ps(m, m, 1));
+    return _mm_cvtss_f32(m);
+}
+
+#else
+
+unsigned RasterTriangle_EvalGroup(
+    const RasterTriangle *tri, int x, int y, unsigned laneMask, bool coverageTest,
+    const float *depth, float *zValues, unsigned *covered)
+{
+    long long base[3];
+    for (int i = 0; i < 3; ++i)
+    {
+        base[i] = RasterEdge_Eval(tri->edges + i, x, y);
+    }
+    float zBase = RasterTriangle_EvalDepth(tri, x + 0.5f, y + 0.5f);
+
+    unsigned coveredMask = 0;
+    unsigned mask = 0;
+    for (int k = 0; k < RASTER_LANES; ++k)
+    {
+        int signs = 0;
+        for (int i = 0; coverageTest && i < 3; ++i)
+        {
+            signs |= RasterEdge_Saturate(base[i]) + tri->laneOffsets[i][k];
+        }
+
+        // Mêmes règles que les instructions min et max SSE
+        float z = zBase + tri->zLaneOffsets[k];
+        z = (z < tri->zmax) ? z : tri->zmax;
+        z = (z > tri->zmin) ? z : tri->zmin;
+        zValues[k] = z;
+
+        if (signs < 0)
+            continue;
+
+        coveredMask |= 1u << k;
+        if (!depth || zValues[k] <= depth[k])
+        {
+            mask |= 1u << k;
+        }
+    }
+
+    *covered = coveredMask & laneMask;
+    return mask & laneMask;
+}
+
+float RasterGroup_GetMaxDepth(
+    unsigned laneMask, unsigned pass, const float *zValues, const float *depth)
+{
+    float zmax = -INFINITY;
+    for (int k = 0; k < RASTER_LANES; ++k)
+    {
+        if ((laneMask & (1u << k)) == 0)
+            continue;
+
+        float z = (pass & (1u << k)) ? zValues[k] : depth[k];
+        zmax = (z > zmax) ? z : zmax;
+    }
+    return zmax;
+}
+
+#endif
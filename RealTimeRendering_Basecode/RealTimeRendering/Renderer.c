@@ -1,191 +1,2135 @@
-#include "Renderer.h"
-#include "Camera.h"
-#include "Tools.h"
-
-Renderer *Renderer_New(SDL_Renderer *rendererSDL)
-{
-    Renderer *renderer = NULL;
-    int width = 0;
-    int height = 0;
-
-    renderer = (Renderer *)calloc(1, sizeof(Renderer));
-    if (!renderer) goto ERROR_LABEL;
-
-    int exitStatus = SDL_GetRendererOutputSize(rendererSDL, &width, &height);
-    if (exitStatus < 0)
-    {
-        printf("ERROR - RE_Renderer_setLogicalSize()\n");
-        printf("      - %s\n", SDL_GetError());
-        goto ERROR_LABEL;
-    }
-
-    renderer->m_width = width;
-    renderer->m_height = height;
-    renderer->m_rendererSDL = rendererSDL;
-
-    renderer->m_zBuffer = (float **)calloc(width, sizeof(float *));
-    if (!renderer->m_zBuffer) goto ERROR_LABEL;
-
-    for (int x = 0; x < width; ++x)
-    {
-        renderer->m_zBuffer[x] = (float *)calloc(height, sizeof(float));
-        if (!renderer->m_zBuffer[x]) goto ERROR_LABEL;
-    }
-
-    renderer->m_streamTex = SDL_CreateTexture(
-        rendererSDL, SDL_PIXELFORMAT_RGBA8888, SDL_TEXTUREACCESS_STREAMING,
-        width, height);
-    if (!renderer->m_streamTex) goto ERROR_LABEL;
-
-    renderer->m_pixels = (Uint32 *)calloc((size_t)width * (size_t)height, sizeof(Uint32));
-    if (!renderer->m_pixels) goto ERROR_LABEL;
-
-    return renderer;
-
-ERROR_LABEL:
-    printf("ERROR - Renderer_new()\n");
-    assert(false);
-    return NULL;
-}
-
-void Renderer_Free(Renderer *renderer)
-{
-    if (!renderer) return;
-
-    if (renderer->m_streamTex)
-    {
-        SDL_DestroyTexture(renderer->m_streamTex);
-    }
-    if (renderer->m_rendererSDL)
-    {
-        SDL_DestroyRenderer(renderer->m_rendererSDL);
-    }
-
-    if (renderer->m_zBuffer)
-    {
-        int width = renderer->m_width;
-        float **zBuffer = renderer->m_zBuffer;
-        for (int x = 0; x < renderer->m_width; ++x)
-        {
-            if (zBuffer[x])
-            {
-                free(zBuffer[x]);
-            }
-        }
-        free(zBuffer);
-    }
-    free(renderer->m_pixels);
-
-    // Met  zro la mmoire (scurit)
-    memset(renderer, 0, sizeof(Renderer));
-
-    free(renderer);
-}
-
-void Renderer_SetPixel(Renderer *renderer, int x, int y, float zValue, Vec4 color, bool zWrite)
-{
-    if (x < 0 || x >= renderer->m_width ||
-        y < 0 || y >= renderer->m_height)
-        return;
-
-    y = renderer->m_height - 1 - y;
-//#pragma omp critical
-    {
-        if (zValue <= renderer->m_zBuffer[x][y])
-        {
-            SDL_Renderer *rendererSDL = renderer->m_rendererSDL;
-            int r = Int_Clamp((int)(255.f * color.x), 0, 255);
-            int g = Int_Clamp((int)(255.f * color.y), 0, 255);
-            int b = Int_Clamp((int)(255.f * color.z), 0, 255);
-            int a = Int_Clamp((int)(255.f * color.w), 0, 255);
-
-            renderer->m_pixels[y * renderer->m_width + x] =
-                ((Uint32)r << 24) |
-                ((Uint32)g << 16) |
-                ((Uint32)b <<  8) |
-                ((Uint32)a <<  0);
-
-            if (zWrite)
-            {
-                renderer->m_zBuffer[x][y] = zValue;
-            }
-        }
-    }
-}
-
-void Renderer_DrawLine(Renderer *renderer, Vec3 p0, Vec3 p1, Vec4 color)
-{
-    // Algorithme de Bresenham (cf wikipedia anglais)
-    int w = Renderer_GetWidth(renderer);
-    int h = Renderer_GetHeight(renderer);
-    int x0 = (int)(w * (p0.x + 1.0f) / 2.0f);
-    int y0 = (int)(h * (p0.y + 1.0f) / 2.0f);
-    int x1 = (int)(w * (p1.x + 1.0f) / 2.0f);
-    int y1 = (int)(h * (p1.y + 1.0f) / 2.0f);
-    int dx = +abs(x1 - x0);
-    int dy = -abs(y1 - y0);
-    int sx = x0 < x1 ? 1 : -1;
-    int sy = y0 < y1 ? 1 : -1;
-    int err = dx + dy;
-
-    while (true)
-    {
-        // Dessine toujours le pixel (zValue = -2.0f)
-        Renderer_SetPixel(renderer, x0, y0, -2.0f, color, true);
-
-        if (x0 == x1 && y0 == y1) break;
-        int e2 = 2 * err;
-        if (e2 >= dy) // e_xy + e_x > 0
-        {
-            err += dy;
-            x0 += sx;
-        }
-        if (e2 <= dx) // e_xy + e_y < 0
-        {
-            err += dx;
-            y0 += sy;
-        }
-    }
-}
-
-void Renderer_ResetDepthBuffer(Renderer *renderer)
-{
-    // Les points entres les plans near et far ont une profondeur dans [-1.0f, 1.0f]
-    int width = Renderer_GetWidth(renderer);
-    int height = Renderer_GetHeight(renderer);
-    float **zBuffer = renderer->m_zBuffer;
-
-    for (int x = 0; x < width; x++)
-    {
-        for (int y = 0; y < height; y++)
-        {
-            zBuffer[x][y] = 2.f;
-        }
-    }
-}
-
-void Renderer_Fill(Renderer *renderer, Vec4 color)
-{
-    SDL_Renderer *rendererSDL = renderer->m_rendererSDL;
-    Uint8 r = (Uint8)(Int_Clamp((int)(255.f * color.x), 0, 255));
-    Uint8 g = (Uint8)(Int_Clamp((int)(255.f * color.y), 0, 255));
-    Uint8 b = (Uint8)(Int_Clamp((int)(255.f * color.z), 0, 255));
-    Uint8 a = (Uint8)(Int_Clamp((int)(255.f * color.w), 0, 255));
-    Uint32 val = ((Uint32)r << 24) | ((Uint32)g << 16) | ((Uint32)b << 8) | ((Uint32)a << 0);
-
-    int size = renderer->m_height * renderer->m_width;
-    for (int i = 0; i < size; ++i)
-    {
-        renderer->m_pixels[i] = val;
-    }
-}
-
-void Renderer_Update(Renderer *renderer)
-{
-    SDL_Texture *texture = renderer->m_streamTex;
-    Uint32 *pixels = renderer->m_pixels;
-
-    SDL_UpdateTexture(texture, NULL, pixels, renderer->m_width * sizeof (Uint32));
-    SDL_RenderCopy(renderer->m_rendererSDL, texture, NULL, NULL);
-    SDL_RenderPresent(renderer->m_rendererSDL);
-}
+#include "Renderer.h"
+#include "Camera.h"
+#include "Tools.h"
+#include "TileBins.h"
+
+#if defined(RASTER_KERNEL_AVX2) || defined(RASTER_KERNEL_SSE2)
+#  include <immintrin.h>
+#endif
+
+#ifdef _MSC_VER
+#  include <intrin.h>
+#endif
+
+/// @brief Choisit le format des pixels de la texture : le premier format 32 bits
+/// pris en charge parmi les formats natifs du moteur de rendu SDL (aucune
+/// conversion par le pilote), RGBA8888 par défaut.
+static void Renderer_ChoosePixelFormat(Renderer *renderer)
+{
+    SDL_RendererInfo info = { 0 };
+    Uint32 format = SDL_PIXELFORMAT_RGBA8888;
+
+    if (renderer->m_rendererSDL && SDL_GetRendererInfo(renderer->m_rendererSDL, &info) == 0)
+    {
+        for (Uint32 i = 0; i < info.num_texture_formats; ++i)
+        {
+            Uint32 native = info.texture_formats[i];
+            if (native == SDL_PIXELFORMAT_RGBA8888 || native == SDL_PIXELFORMAT_ARGB8888 ||
+                native == SDL_PIXELFORMAT_ABGR8888 || native == SDL_PIXELFORMAT_BGRA8888)
+            {
+                format = native;
+                break;
+            }
+        }
+    }
+
+    // Décalages des composantes rouge, verte, bleue et alpha
+    int *shifts = renderer->m_colorShifts;
+    switch (format)
+    {
+    case SDL_PIXELFORMAT_ARGB8888:
+        shifts[0] = 16; shifts[1] = 8;  shifts[2] = 0;  shifts[3] = 24;
+        break;
+    case SDL_PIXELFORMAT_ABGR8888:
+        shifts[0] = 0;  shifts[1] = 8;  shifts[2] = 16; shifts[3] = 24;
+        break;
+    case SDL_PIXELFORMAT_BGRA8888:
+        shifts[0] = 8;  shifts[1] = 16; shifts[2] = 24; shifts[3] = 0;
+        break;
+    default:
+        shifts[0] = 24; shifts[1] = 16; shifts[2] = 8;  shifts[3] = 0;
+        break;
+    }
+    renderer->m_pixelFormat = format;
+}
+
+/// @brief Crée un moteur de rendu, associé à un moteur de rendu SDL ou hors écran.
+/// @param rendererSDL le moteur de rendu SDL, ou NULL pour un rendu hors écran.
+/// @param width, height les dimensions de l'image rendue.
+static Renderer *Renderer_Create(SDL_Renderer *rendererSDL, int width, int height)
+{
+    Renderer *renderer = NULL;
+    int exitStatus;
+
+    renderer = (Renderer *)calloc(1, sizeof(Renderer));
+    if (!renderer) goto ERROR_LABEL;
+
+    renderer->m_width = width;
+    renderer->m_height = height;
+    renderer->m_viewport = (SDL_Rect){ 0, 0, width, height };
+    renderer->m_resolutionScale = 1.0f;
+    renderer->m_renderWidth = width;
+    renderer->m_renderHeight = height;
+    renderer->m_renderViewport = renderer->m_viewport;
+    renderer->m_rendererSDL = rendererSDL;
+
+    renderer->m_hiZWidth = (width + RASTER_BLOCK_SIZE - 1) / RASTER_BLOCK_SIZE;
+    renderer->m_hiZHeight = (height + RASTER_BLOCK_SIZE - 1) / RASTER_BLOCK_SIZE;
+    renderer->m_hiZ = (float *)calloc(
+        (size_t)renderer->m_hiZWidth * (size_t)renderer->m_hiZHeight, sizeof(float));
+    if (!renderer->m_hiZ) goto ERROR_LABEL;
+
+    Renderer_ChoosePixelFormat(renderer);
+    renderer->m_pitch = width;
+
+    if (rendererSDL)
+    {
+        renderer->m_streamTex = SDL_CreateTexture(
+            rendererSDL, renderer->m_pixelFormat, SDL_TEXTUREACCESS_STREAMING,
+            width, height);
+        if (!renderer->m_streamTex) goto ERROR_LABEL;
+
+        // Les lignes des buffers ont le pas de la texture, pour permettre le rendu direct
+        void *texturePixels = NULL;
+        int texturePitch = 0;
+        exitStatus = SDL_LockTexture(renderer->m_streamTex, NULL, &texturePixels, &texturePitch);
+        if (exitStatus < 0)
+        {
+            printf("SDL_LockTexture Error: %s\n", SDL_GetError());
+            goto ERROR_LABEL;
+        }
+        SDL_UnlockTexture(renderer->m_streamTex);
+
+        // Un pas inutilisable désactive seulement le rendu direct (voir Renderer_BeginFrame())
+        if (texturePitch % sizeof(Uint32) == 0 && texturePitch / (int)sizeof(Uint32) >= width)
+        {
+            renderer->m_pitch = texturePitch / (int)sizeof(Uint32);
+        }
+    }
+
+    // Les buffers contiennent un nombre entier de blocs, quel que soit le rangement
+    renderer->m_layout = RENDERER_LAYOUT_LINEAR;
+    renderer->m_depthFormat = RENDERER_DEPTH_FLOAT;
+    renderer->m_bufferSize = (size_t)renderer->m_hiZWidth * (size_t)renderer->m_hiZHeight
+        * RASTER_BLOCK_SIZE * RASTER_BLOCK_SIZE;
+    size_t linearSize = (size_t)renderer->m_pitch * (size_t)height;
+    if (linearSize > renderer->m_bufferSize)
+    {
+        renderer->m_bufferSize = linearSize;
+    }
+    renderer->m_samplePlaneSize = renderer->m_bufferSize;
+
+    renderer->m_zBuffer = (float *)calloc(renderer->m_bufferSize, sizeof(float));
+    if (!renderer->m_zBuffer) goto ERROR_LABEL;
+
+    renderer->m_pixelBuffer = (Uint32 *)calloc(renderer->m_bufferSize, sizeof(Uint32));
+    if (!renderer->m_pixelBuffer) goto ERROR_LABEL;
+
+    renderer->m_pixels = renderer->m_pixelBuffer;
+
+    renderer->m_tileBins = TileBins_New(width, height);
+    if (!renderer->m_tileBins) goto ERROR_LABEL;
+
+    renderer->m_tileClearFlags = (Uint8 *)calloc(
+        TileBins_GetTileCount(renderer->m_tileBins), sizeof(Uint8));
+    if (!renderer->m_tileClearFlags) goto ERROR_LABEL;
+
+    renderer->m_statsCount = omp_get_max_threads();
+    renderer->m_stats = (RendererStats *)calloc(renderer->m_statsCount, sizeof(RendererStats));
+    if (!renderer->m_stats) goto ERROR_LABEL;
+
+    renderer->m_presentMutex = SDL_CreateMutex();
+    if (!renderer->m_presentMutex) goto ERROR_LABEL;
+
+    renderer->m_presentCond = SDL_CreateCond();
+    if (!renderer->m_presentCond) goto ERROR_LABEL;
+
+    renderer->m_hierarchical = true;
+    renderer->m_samples = 1;
+    renderer->m_foveaCenter = Vec2_Set(0.5f, 0.5f);
+    renderer->m_foveaRadius = 0.25f;
+    renderer->m_presentMode = RENDERER_PRESENT_SYNC;
+
+    Renderer_SetToneMapping(renderer, 1.0f, 2.2f);
+
+    return renderer;
+
+ERROR_LABEL:
+    printf("ERROR - Renderer_Create()\n");
+    assert(false);
+    return NULL;
+}
+
+Renderer *Renderer_New(SDL_Renderer *rendererSDL)
+{
+    int width = 0;
+    int height = 0;
+
+    int exitStatus = SDL_GetRendererOutputSize(rendererSDL, &width, &height);
+    if (exitStatus < 0)
+    {
+        printf("ERROR - RE_Renderer_setLogicalSize()\n");
+        printf("      - %s\n", SDL_GetError());
+        goto ERROR_LABEL;
+    }
+
+    return Renderer_Create(rendererSDL, width, height);
+
+ERROR_LABEL:
+    printf("ERROR - Renderer_new()\n");
+    assert(false);
+    return NULL;
+}
+
+Renderer *Renderer_NewOffscreen(int width, int height)
+{
+    assert(width > 0 && height > 0);
+    return Renderer_Create(NULL, width, height);
+}
+
+static void Renderer_StopRenderThread(Renderer *renderer);
+
+/// @brief Convertit un rectangle de l'image en rectangle à la résolution interne.
+/// Les bords sont arrondis de la même façon pour des rectangles adjacents.
+static SDL_Rect Renderer_ScaleRect(Renderer *renderer, SDL_Rect rect)
+{
+    Sint64 width = renderer->m_width, height = renderer->m_height;
+    Sint64 renderWidth = renderer->m_renderWidth, renderHeight = renderer->m_renderHeight;
+
+    int x0 = (int)(rect.x * renderWidth / width);
+    int y0 = (int)(rect.y * renderHeight / height);
+    int x1 = (int)((rect.x + rect.w) * renderWidth / width);
+    int y1 = (int)((rect.y + rect.h) * renderHeight / height);
+
+    // Un rectangle non vide reste non vide
+    x1 = Int_Max(x1, x0 + 1);
+    y1 = Int_Max(y1, y0 + 1);
+
+    return (SDL_Rect){ x0, y0, x1 - x0, y1 - y0 };
+}
+
+void Renderer_SetViewport(Renderer *renderer, SDL_Rect viewport)
+{
+    assert(viewport.w > 0 && viewport.h > 0);
+    assert(viewport.x >= 0 && viewport.x + viewport.w <= renderer->m_width);
+    assert(viewport.y >= 0 && viewport.y + viewport.h <= renderer->m_height);
+
+    renderer->m_viewport = viewport;
+    renderer->m_renderViewport = Renderer_ScaleRect(renderer, viewport);
+}
+
+void Renderer_Free(Renderer *renderer)
+{
+    if (!renderer) return;
+
+    // L'image en attente est présentée avant la destruction de la texture
+    Renderer_StopRenderThread(renderer);
+
+    if (renderer->m_streamTex)
+    {
+        if (renderer->m_textureLocked)
+        {
+            SDL_UnlockTexture(renderer->m_streamTex);
+        }
+        SDL_DestroyTexture(renderer->m_streamTex);
+    }
+    if (renderer->m_rendererSDL)
+    {
+        SDL_DestroyRenderer(renderer->m_rendererSDL);
+    }
+
+    free(renderer->m_zBuffer);
+    free(renderer->m_zBuffer16);
+    free(renderer->m_hiZ);
+    free(renderer->m_sampleDepths);
+    free(renderer->m_sampleDepths16);
+    free(renderer->m_sampleColors);
+    free(renderer->m_hdrPixels);
+    free(renderer->m_hdrSampleColors);
+    free(renderer->m_packedPixels);
+    free(renderer->m_upscaleColumns);
+    free(renderer->m_shadingRates);
+    free(renderer->m_pixelBuffer);
+    for (int i = 0; i < RENDERER_MAX_FRAMES; ++i)
+    {
+        free(renderer->m_frames[i]);
+    }
+    if (renderer->m_presentCond)
+    {
+        SDL_DestroyCond(renderer->m_presentCond);
+    }
+    if (renderer->m_presentMutex)
+    {
+        SDL_DestroyMutex(renderer->m_presentMutex);
+    }
+    TileBins_Free(renderer->m_tileBins);
+    free(renderer->m_tileClearFlags);
+    free(renderer->m_stats);
+
+    // Met à zéro la mémoire (sécurité)
+    memset(renderer, 0, sizeof(Renderer));
+
+    free(renderer);
+}
+
+/// @brief Alloue les buffers nécessaires à un nombre d'échantillons, à un format
+/// de profondeur et à un format de couleur qui ne l'ont pas encore été.
+/// Les buffers alloués sont conservés jusqu'à la destruction du moteur de rendu.
+static int Renderer_AllocateBuffers(
+    Renderer *renderer, int samples, RendererDepthFormat format, bool hdr)
+{
+    size_t size = renderer->m_bufferSize;
+    // Un plan par échantillon (voir Renderer_GetSampleIndex())
+    size_t sampleSize = renderer->m_samplePlaneSize * RASTER_MSAA_SAMPLES;
+    bool depth16 = (format == RENDERER_DEPTH_UNORM16);
+
+    if (depth16 && !renderer->m_zBuffer16)
+    {
+        renderer->m_zBuffer16 = (Uint16 *)calloc(size, sizeof(Uint16));
+        if (!renderer->m_zBuffer16) goto ERROR_LABEL;
+    }
+
+    if (hdr && !renderer->m_hdrPixels)
+    {
+        renderer->m_hdrPixels = (Vec4 *)calloc(size, sizeof(Vec4));
+        if (!renderer->m_hdrPixels) goto ERROR_LABEL;
+    }
+
+    if (samples > 1 && hdr && !renderer->m_hdrSampleColors)
+    {
+        renderer->m_hdrSampleColors = (Vec4 *)calloc(sampleSize, sizeof(Vec4));
+        if (!renderer->m_hdrSampleColors) goto ERROR_LABEL;
+    }
+    if (samples > 1 && !hdr && !renderer->m_sampleColors)
+    {
+        renderer->m_sampleColors = (Uint32 *)calloc(sampleSize, sizeof(Uint32));
+        if (!renderer->m_sampleColors) goto ERROR_LABEL;
+    }
+    if (samples > 1 && !depth16 && !renderer->m_sampleDepths)
+    {
+        renderer->m_sampleDepths = (float *)calloc(sampleSize, sizeof(float));
+        if (!renderer->m_sampleDepths) goto ERROR_LABEL;
+    }
+    if (samples > 1 && depth16 && !renderer->m_sampleDepths16)
+    {
+        renderer->m_sampleDepths16 = (Uint16 *)calloc(sampleSize, sizeof(Uint16));
+        if (!renderer->m_sampleDepths16) goto ERROR_LABEL;
+    }
+
+    return EXIT_SUCCESS;
+
+ERROR_LABEL:
+    printf("ERROR - Renderer_AllocateBuffers()\n");
+    assert(false);
+    return EXIT_FAILURE;
+}
+
+int Renderer_SetSampleCount(Renderer *renderer, int samples)
+{
+    assert(samples == 1 || samples == RASTER_MSAA_SAMPLES);
+
+    // Les écritures regroupées ne gèrent qu'un échantillon par pixel
+    if (samples > 1 && renderer->m_writeMode != RENDERER_WRITE_TILED) goto ERROR_LABEL;
+
+    int exitStatus = Renderer_AllocateBuffers(
+        renderer, samples, renderer->m_depthFormat, renderer->m_hdr);
+    if (exitStatus != EXIT_SUCCESS) goto ERROR_LABEL;
+
+    renderer->m_samples = samples;
+
+    return EXIT_SUCCESS;
+
+ERROR_LABEL:
+    printf("ERROR - Renderer_SetSampleCount()\n");
+    assert(false);
+    return EXIT_FAILURE;
+}
+
+int Renderer_SetDepthFormat(Renderer *renderer, RendererDepthFormat format)
+{
+    assert(format >= 0 && format < RENDERER_DEPTH_FORMAT_COUNT);
+
+    int exitStatus = Renderer_AllocateBuffers(
+        renderer, renderer->m_samples, format, renderer->m_hdr);
+    if (exitStatus != EXIT_SUCCESS) goto ERROR_LABEL;
+
+    renderer->m_depthFormat = format;
+
+    return EXIT_SUCCESS;
+
+ERROR_LABEL:
+    printf("ERROR - Renderer_SetDepthFormat()\n");
+    assert(false);
+    return EXIT_FAILURE;
+}
+
+int Renderer_SetHdr(Renderer *renderer, bool hdr)
+{
+    // Les écritures regroupées ne gèrent que les couleurs 32 bits
+    if (hdr && renderer->m_writeMode != RENDERER_WRITE_TILED) goto ERROR_LABEL;
+
+    int exitStatus = Renderer_AllocateBuffers(
+        renderer, renderer->m_samples, renderer->m_depthFormat, hdr);
+    if (exitStatus != EXIT_SUCCESS) goto ERROR_LABEL;
+
+    renderer->m_hdr = hdr;
+
+    return EXIT_SUCCESS;
+
+ERROR_LABEL:
+    printf("ERROR - Renderer_SetHdr()\n");
+    assert(false);
+    return EXIT_FAILURE;
+}
+
+int Renderer_SetWriteMode(Renderer *renderer, RendererWriteMode mode)
+{
+    assert(mode >= 0 && mode < RENDERER_WRITE_MODE_COUNT);
+
+    if (mode != RENDERER_WRITE_TILED)
+    {
+        // Profondeur et couleur doivent tenir dans 64 bits
+        if (renderer->m_samples > 1 || renderer->m_hdr) goto ERROR_LABEL;
+
+        if (!renderer->m_packedPixels)
+        {
+            renderer->m_packedPixels = (Uint64 *)calloc(renderer->m_bufferSize, sizeof(Uint64));
+            if (!renderer->m_packedPixels) goto ERROR_LABEL;
+        }
+    }
+
+    renderer->m_writeMode = mode;
+
+    return EXIT_SUCCESS;
+
+ERROR_LABEL:
+    printf("ERROR - Renderer_SetWriteMode()\n");
+    assert(false);
+    return EXIT_FAILURE;
+}
+
+void Renderer_SetToneMapping(Renderer *renderer, float exposure, float gamma)
+{
+    assert(exposure > 0.0f && gamma > 0.0f);
+
+    renderer->m_exposure = exposure;
+    for (int i = 0; i < RENDERER_GAMMA_LUT_SIZE; ++i)
+    {
+        float value = (float)i / (float)(RENDERER_GAMMA_LUT_SIZE - 1);
+        renderer->m_gammaLut[i] = (Uint8)lrintf(255.0f * powf(value, 1.0f / gamma));
+    }
+}
+
+/// @brief Alloue les premiers framebuffers qui ne l'ont pas encore été.
+static int Renderer_AllocateFrames(Renderer *renderer, int frameCount)
+{
+    size_t size = (size_t)renderer->m_width * (size_t)renderer->m_height;
+
+    for (int i = 0; i < frameCount; ++i)
+    {
+        if (!renderer->m_frames[i])
+        {
+            renderer->m_frames[i] = (Uint32 *)calloc(size, sizeof(Uint32));
+            if (!renderer->m_frames[i]) goto ERROR_LABEL;
+        }
+    }
+
+    return EXIT_SUCCESS;
+
+ERROR_LABEL:
+    printf("ERROR - Renderer_AllocateFrames()\n");
+    assert(false);
+    return EXIT_FAILURE;
+}
+
+/// @brief Déverrouille la texture si elle l'est : les pixels sont de nouveau
+/// écrits dans m_pixelBuffer. L'image en cours de rendu est perdue.
+static void Renderer_ReleaseTexture(Renderer *renderer)
+{
+    if (!renderer->m_textureLocked)
+        return;
+
+    SDL_UnlockTexture(renderer->m_streamTex);
+    renderer->m_textureLocked = false;
+    renderer->m_pixels = renderer->m_pixelBuffer;
+}
+
+/// @brief Calcule les pixels sources d'un pixel de l'image agrandie selon un axe :
+/// le centre du pixel est ramené à la résolution interne, entre deux centres de pixels.
+/// @param p la coordonnée du pixel dans l'image.
+/// @param size la dimension de l'image selon l'axe.
+/// @param renderSize la dimension de l'image à la résolution interne.
+static RendererUpscaleTap Renderer_GetUpscaleTap(int p, int size, int renderSize)
+{
+    RendererUpscaleTap tap = { 0 };
+    float u = fmaxf(((float)p + 0.5f) * (float)renderSize / (float)size - 0.5f, 0.0f);
+
+    tap.p0 = Int_Min((int)u, renderSize - 1);
+    tap.p1 = Int_Min(tap.p0 + 1, renderSize - 1);
+    tap.weight = (Uint32)Int_Clamp((int)((u - (float)tap.p0) * 256.0f + 0.5f), 0, 256);
+    return tap;
+}
+
+/// @brief Applique un facteur d'échelle de la résolution interne, les buffers
+/// de l'agrandissement étant alloués (voir Renderer_SetResolutionScale()).
+static void Renderer_ApplyResolutionScale(Renderer *renderer, float scale)
+{
+    int width = renderer->m_width;
+    int height = renderer->m_height;
+
+    renderer->m_resolutionScale = scale;
+    renderer->m_renderWidth = Int_Clamp((int)lrintf(scale * (float)width), 1, width);
+    renderer->m_renderHeight = Int_Clamp((int)lrintf(scale * (float)height), 1, height);
+    renderer->m_renderViewport = Renderer_ScaleRect(renderer, renderer->m_viewport);
+
+    if (renderer->m_upscaleColumns)
+    {
+        for (int x = 0; x < width; ++x)
+        {
+            renderer->m_upscaleColumns[x] = Renderer_GetUpscaleTap(
+                x, width, renderer->m_renderWidth);
+        }
+    }
+}
+
+/// @brief Indique si l'image est rendue à une résolution inférieure à celle de l'image.
+static bool Renderer_IsUpscaled(Renderer *renderer)
+{
+    return renderer->m_renderWidth != renderer->m_width ||
+        renderer->m_renderHeight != renderer->m_height;
+}
+
+/// @brief Alloue les buffers nécessaires à l'agrandissement de l'image : la table
+/// des colonnes et le premier framebuffer, qui reçoit l'image agrandie.
+static int Renderer_AllocateUpscale(Renderer *renderer)
+{
+    if (!renderer->m_upscaleColumns)
+    {
+        renderer->m_upscaleColumns = (RendererUpscaleTap *)calloc(
+            renderer->m_width, sizeof(RendererUpscaleTap));
+        if (!renderer->m_upscaleColumns) goto ERROR_LABEL;
+    }
+
+    int exitStatus = Renderer_AllocateFrames(renderer, 1);
+    if (exitStatus != EXIT_SUCCESS) goto ERROR_LABEL;
+
+    return EXIT_SUCCESS;
+
+ERROR_LABEL:
+    printf("ERROR - Renderer_AllocateUpscale()\n");
+    assert(false);
+    return EXIT_FAILURE;
+}
+
+int Renderer_SetResolutionScale(Renderer *renderer, float scale)
+{
+    assert(scale >= RENDERER_MIN_RESOLUTION_SCALE && scale <= 1.0f);
+
+    int exitStatus = Renderer_AllocateUpscale(renderer);
+    if (exitStatus != EXIT_SUCCESS) goto ERROR_LABEL;
+
+    // Le rendu direct n'est utilisé qu'en pleine résolution
+    Renderer_ReleaseTexture(renderer);
+    Renderer_ApplyResolutionScale(renderer, scale);
+
+    return EXIT_SUCCESS;
+
+ERROR_LABEL:
+    printf("ERROR - Renderer_SetResolutionScale()\n");
+    assert(false);
+    return EXIT_FAILURE;
+}
+
+int Renderer_SetDynamicResolution(Renderer *renderer, float targetFrameTime)
+{
+    assert(targetFrameTime >= 0.0f);
+
+    int exitStatus = Renderer_SetResolutionScale(renderer, 1.0f);
+    if (exitStatus != EXIT_SUCCESS) goto ERROR_LABEL;
+
+    renderer->m_targetFrameTime = targetFrameTime;
+    renderer->m_frameTime = 0.0f;
+
+    return EXIT_SUCCESS;
+
+ERROR_LABEL:
+    printf("ERROR - Renderer_SetDynamicResolution()\n");
+    assert(false);
+    return EXIT_FAILURE;
+}
+
+/// @brief Choisit le facteur d'échelle de la résolution interne de l'image suivante
+/// (résolution dynamique). Le coût du rendu étant à peu près proportionnel au nombre
+/// de pixels, le facteur est multiplié par la racine du rapport entre la durée visée
+/// (un peu sous la durée cible) et la durée moyenne des dernières images. Les petits
+/// écarts sont ignorés et le facteur diminue plus vite qu'il n'augmente, pour éviter
+/// les oscillations.
+static void Renderer_UpdateResolutionScale(Renderer *renderer)
+{
+    if (renderer->m_targetFrameTime <= 0.0f || renderer->m_frameTime <= 0.0f)
+        return;
+
+    float ratio = 0.9f * renderer->m_targetFrameTime / renderer->m_frameTime;
+    if (ratio > 0.9f && ratio < 1.1f)
+        return;
+
+    float scale = renderer->m_resolutionScale;
+    float factor = Float_Clamp(sqrtf(ratio), 0.8f, 1.05f);
+    float newScale = Float_Clamp(scale * factor, RENDERER_MIN_RESOLUTION_SCALE, 1.0f);
+    if (newScale == scale)
+        return;
+
+    Renderer_ApplyResolutionScale(renderer, newScale);
+
+    // Durée attendue à la nouvelle résolution, jusqu'aux prochaines mesures
+    renderer->m_frameTime *= (newScale * newScale) / (scale * scale);
+}
+
+void Renderer_SetZeroCopy(Renderer *renderer, bool zeroCopy)
+{
+    Renderer_ReleaseTexture(renderer);
+    renderer->m_zeroCopy = zeroCopy;
+}
+
+/// @brief Calcule le taux d'ombrage de chaque bloc selon sa distance au centre
+/// de la zone ombrée en pleine résolution (voir RENDERER_SHADING_FOVEATED).
+static void Renderer_UpdateFoveatedRates(Renderer *renderer)
+{
+    // Zone exprimée dans le repère raster, à la résolution interne
+    float height = (float)renderer->m_renderHeight;
+    float cx = renderer->m_foveaCenter.x * (float)renderer->m_renderWidth;
+    float cy = (1.0f - renderer->m_foveaCenter.y) * height;
+    float radius = renderer->m_foveaRadius * height;
+
+    for (int by = 0; by < renderer->m_hiZHeight; ++by)
+    {
+        for (int bx = 0; bx < renderer->m_hiZWidth; ++bx)
+        {
+            float dx = ((float)bx + 0.5f) * RASTER_BLOCK_SIZE - cx;
+            float dy = ((float)by + 0.5f) * RASTER_BLOCK_SIZE - cy;
+            float distance = sqrtf(dx * dx + dy * dy);
+
+            RendererShadingRate rate = RENDERER_SHADING_RATE_4X4;
+            if (distance <= radius) rate = RENDERER_SHADING_RATE_1X1;
+            else if (distance <= 2.0f * radius) rate = RENDERER_SHADING_RATE_2X2;
+
+            renderer->m_shadingRates[by * renderer->m_hiZWidth + bx] = (Uint8)rate;
+        }
+    }
+}
+
+/// @brief Renvoie la luminance (sur 255) d'un pixel au format de la texture.
+static int Renderer_GetLuma(Renderer *renderer, Uint32 value)
+{
+    const int *shifts = renderer->m_colorShifts;
+    int r = (value >> shifts[0]) & 0xFF;
+    int g = (value >> shifts[1]) & 0xFF;
+    int b = (value >> shifts[2]) & 0xFF;
+    return (77 * r + 150 * g + 29 * b) >> 8;
+}
+
+/// @brief Calcule le taux d'ombrage de chaque bloc à partir de l'image qui vient
+/// d'être rendue (voir RENDERER_SHADING_CONTENT) : le plus grand écart de luminance
+/// entre pixels voisins du bloc est comparé aux seuils RENDERER_SHADING_CONTRAST_*.
+static void Renderer_UpdateContentRates(Renderer *renderer)
+{
+    int renderWidth = renderer->m_renderWidth;
+    int renderHeight = renderer->m_renderHeight;
+    int bxCount = (renderWidth + RASTER_BLOCK_SIZE - 1) / RASTER_BLOCK_SIZE;
+    int byCount = (renderHeight + RASTER_BLOCK_SIZE - 1) / RASTER_BLOCK_SIZE;
+
+    #pragma omp parallel for schedule(static)
+    for (int by = 0; by < byCount; ++by)
+    {
+        int ymin = by * RASTER_BLOCK_SIZE;
+        int ymax = Int_Min(ymin + RASTER_BLOCK_SIZE, renderHeight) - 1;
+
+        for (int bx = 0; bx < bxCount; ++bx)
+        {
+            int xmin = bx * RASTER_BLOCK_SIZE;
+            int xmax = Int_Min(xmin + RASTER_BLOCK_SIZE, renderWidth) - 1;
+
+            int luma[RASTER_BLOCK_SIZE][RASTER_BLOCK_SIZE];
+            int contrast = 0;
+            for (int y = ymin; y <= ymax; ++y)
+            {
+                for (int x = xmin; x <= xmax; ++x)
+                {
+                    int l = Renderer_GetLuma(
+                        renderer, renderer->m_pixels[Renderer_GetIndex(renderer, x, y)]);
+                    luma[y - ymin][x - xmin] = l;
+
+                    if (x > xmin) contrast = Int_Max(contrast, abs(l - luma[y - ymin][x - xmin - 1]));
+                    if (y > ymin) contrast = Int_Max(contrast, abs(l - luma[y - ymin - 1][x - xmin]));
+                }
+            }
+
+            RendererShadingRate rate = RENDERER_SHADING_RATE_1X1;
+            if (contrast < RENDERER_SHADING_CONTRAST_4X4) rate = RENDERER_SHADING_RATE_4X4;
+            else if (contrast < RENDERER_SHADING_CONTRAST_2X2) rate = RENDERER_SHADING_RATE_2X2;
+
+            renderer->m_shadingRates[by * renderer->m_hiZWidth + bx] = (Uint8)rate;
+        }
+    }
+}
+
+int Renderer_SetShadingMode(Renderer *renderer, RendererShadingMode mode)
+{
+    assert(mode >= 0 && mode < RENDERER_SHADING_MODE_COUNT);
+
+    size_t blockCount = (size_t)renderer->m_hiZWidth * (size_t)renderer->m_hiZHeight;
+    if (mode != RENDERER_SHADING_FULL && !renderer->m_shadingRates)
+    {
+        renderer->m_shadingRates = (Uint8 *)calloc(blockCount, sizeof(Uint8));
+        if (!renderer->m_shadingRates) goto ERROR_LABEL;
+    }
+
+    // Sans image précédente, tous les blocs sont ombrés en pleine résolution
+    if (renderer->m_shadingRates)
+    {
+        memset(renderer->m_shadingRates, RENDERER_SHADING_RATE_1X1, blockCount);
+    }
+    renderer->m_shadingMode = mode;
+
+    return EXIT_SUCCESS;
+
+ERROR_LABEL:
+    printf("ERROR - Renderer_SetShadingMode()\n");
+    assert(false);
+    return EXIT_FAILURE;
+}
+
+void Renderer_SetFoveation(Renderer *renderer, Vec2 center, float radius)
+{
+    assert(radius > 0.0f);
+    renderer->m_foveaCenter = center;
+    renderer->m_foveaRadius = radius;
+}
+
+void Renderer_BeginFrame(Renderer *renderer)
+{
+    Renderer_UpdateResolutionScale(renderer);
+    renderer->m_frameStart = SDL_GetPerformanceCounter();
+
+    if (renderer->m_shadingMode == RENDERER_SHADING_FOVEATED)
+    {
+        Renderer_UpdateFoveatedRates(renderer);
+    }
+
+    bool zeroCopy = renderer->m_zeroCopy && renderer->m_streamTex &&
+        renderer->m_layout == RENDERER_LAYOUT_LINEAR &&
+        renderer->m_presentMode == RENDERER_PRESENT_SYNC &&
+        !Renderer_IsUpscaled(renderer);
+
+    if (!zeroCopy || renderer->m_textureLocked)
+        return;
+
+    void *pixels = NULL;
+    int pitch = 0;
+    if (SDL_LockTexture(renderer->m_streamTex, NULL, &pixels, &pitch) < 0)
+    {
+        // L'image est rendue dans m_pixelBuffer puis copiée
+        printf("SDL_LockTexture Error: %s\n", SDL_GetError());
+        return;
+    }
+    if (pitch != renderer->m_pitch * (int)sizeof(Uint32))
+    {
+        // Les indices des pixels dépendent de m_pitch : l'image est rendue dans
+        // m_pixelBuffer puis copiée avec son propre pas
+        SDL_UnlockTexture(renderer->m_streamTex);
+        return;
+    }
+
+    renderer->m_pixels = (Uint32 *)pixels;
+    renderer->m_textureLocked = true;
+}
+
+int Renderer_SetLayout(Renderer *renderer, RendererLayout layout)
+{
+    assert(layout >= 0 && layout < RENDERER_LAYOUT_COUNT);
+
+    Renderer_ReleaseTexture(renderer);
+
+    // La présentation synchrone copie les pixels rangés par blocs dans le premier framebuffer
+    if (layout != RENDERER_LAYOUT_LINEAR)
+    {
+        int exitStatus = Renderer_AllocateFrames(renderer, 1);
+        if (exitStatus != EXIT_SUCCESS) goto ERROR_LABEL;
+    }
+
+    renderer->m_layout = layout;
+
+    return EXIT_SUCCESS;
+
+ERROR_LABEL:
+    printf("ERROR - Renderer_SetLayout()\n");
+    assert(false);
+    return EXIT_FAILURE;
+}
+
+void Renderer_ResetStats(Renderer *renderer)
+{
+    memset(renderer->m_stats, 0, renderer->m_statsCount * sizeof(RendererStats));
+}
+
+RendererStats Renderer_GetStats(Renderer *renderer)
+{
+    RendererStats stats = { 0 };
+    for (int i = 0; i < renderer->m_statsCount; ++i)
+    {
+        RendererStats *threadStats = renderer->m_stats + i;
+        stats.blocksRejected += threadStats->blocksRejected;
+        stats.blocksAccepted += threadStats->blocksAccepted;
+        stats.blocksPartial += threadStats->blocksPartial;
+        stats.fragmentsShaded += threadStats->fragmentsShaded;
+        stats.verticesShaded += threadStats->verticesShaded;
+        stats.verticesProjected += threadStats->verticesProjected;
+        stats.trianglesCulled += threadStats->trianglesCulled;
+        stats.trianglesClipped += threadStats->trianglesClipped;
+        stats.fragmentsCulled += threadStats->fragmentsCulled;
+        stats.trianglesOccluded += threadStats->trianglesOccluded;
+        stats.blocksOccluded += threadStats->blocksOccluded;
+        stats.atomicWrites += threadStats->atomicWrites;
+        stats.atomicRetries += threadStats->atomicRetries;
+        stats.shadingInvocationsSaved += threadStats->shadingInvocationsSaved;
+        stats.trianglesSmall += threadStats->trianglesSmall;
+        stats.trianglesEmpty += threadStats->trianglesEmpty;
+        for (int j = 0; j < RENDERER_SIZE_BINS; ++j)
+        {
+            stats.triangleSizes[j] += threadStats->triangleSizes[j];
+        }
+    }
+    return stats;
+}
+
+/// @brief Convertit une couleur en un pixel au format de la texture.
+static Uint32 Renderer_PackColor(Renderer *renderer, Vec4 color)
+{
+    const int *shifts = renderer->m_colorShifts;
+    int r = Int_Clamp((int)(255.f * color.x), 0, 255);
+    int g = Int_Clamp((int)(255.f * color.y), 0, 255);
+    int b = Int_Clamp((int)(255.f * color.z), 0, 255);
+    int a = Int_Clamp((int)(255.f * color.w), 0, 255);
+
+    return
+        ((Uint32)r << shifts[0]) |
+        ((Uint32)g << shifts[1]) |
+        ((Uint32)b << shifts[2]) |
+        ((Uint32)a << shifts[3]);
+}
+
+/// @brief Convertit l'indice d'une composante alpha dans la table gamma en sa valeur 8 bits.
+static Uint32 Renderer_GetAlphaValue(int lutIndex)
+{
+    return (Uint32)((lutIndex * 255 + (RENDERER_GAMMA_LUT_SIZE - 1) / 2) / (RENDERER_GAMMA_LUT_SIZE - 1));
+}
+
+#if defined(RASTER_KERNEL_AVX2) || defined(RASTER_KERNEL_SSE2)
+
+/// @brief Convertit des couleurs HDR en pixels au format de la texture : moyenne
+/// des échantillons, exposition, tone mapping, correction gamma (voir
+/// Renderer_SetToneMapping()). Les quatre composantes d'un pixel sont traitées
+/// simultanément, la composante alpha étant seulement limitée à [0, 1].
+/// @param[in] colors les couleurs, sur samples plans de m_bufferSize couleurs
+/// (voir Renderer_GetSampleIndex()).
+/// @param samples le nombre d'échantillons par pixel.
+/// @param[out] pixels les pixels convertis.
+/// @param count le nombre de pixels.
+static void Renderer_ToneMapSpan(
+    Renderer *renderer, const Vec4 *colors, int samples, Uint32 *pixels, int count)
+{
+    const int *shifts = renderer->m_colorShifts;
+    const Uint8 *lut = renderer->m_gammaLut;
+    float scale = renderer->m_exposure / (float)samples;
+
+    const __m128 scales = _mm_setr_ps(scale, scale, scale, 1.0f / (float)samples);
+    const __m128 alphaMask = _mm_castsi128_ps(_mm_setr_epi32(0, 0, 0, -1));
+    const __m128 one = _mm_set1_ps(1.0f);
+    const __m128 lutScale = _mm_set1_ps((float)(RENDERER_GAMMA_LUT_SIZE - 1));
+    const __m128 half = _mm_set1_ps(0.5f);
+
+    for (int i = 0; i < count; ++i)
+    {
+        __m128 sum = _mm_loadu_ps(colors[i].data);
+        for (int s = 1; s < samples; ++s)
+        {
+            sum = _mm_add_ps(sum, _mm_loadu_ps(colors[Renderer_GetSampleIndex(renderer, i, s)].data));
+        }
+
+        // x / (1 + x) pour les composantes rgb, min(x, 1) pour alpha.
+        // max() remplace les NaN par 0, mais une composante infinie donne
+        // Inf / Inf = NaN : min() la ramène à 1 pour que l'indice reste dans la table
+        __m128 x = _mm_max_ps(_mm_mul_ps(sum, scales), _mm_setzero_ps());
+        __m128 t = _mm_div_ps(x, _mm_add_ps(x, one));
+        t = _mm_or_ps(_mm_andnot_ps(alphaMask, t), _mm_and_ps(alphaMask, x));
+        t = _mm_min_ps(t, one);
+
+        __m128i idx = _mm_cvttps_epi32(_mm_add_ps(_mm_mul_ps(t, lutScale), half));
+        int r = _mm_cvtsi128_si32(idx);
+        int g = _mm_cvtsi128_si32(_mm_srli_si128(idx, 4));
+        int b = _mm_cvtsi128_si32(_mm_srli_si128(idx, 8));
+        int a = _mm_cvtsi128_si32(_mm_srli_si128(idx, 12));
+
+        pixels[i] =
+            ((Uint32)lut[r] << shifts[0]) |
+            ((Uint32)lut[g] << shifts[1]) |
+            ((Uint32)lut[b] << shifts[2]) |
+            (Renderer_GetAlphaValue(a) << shifts[3]);
+    }
+}
+
+#else
+
+// Version scalaire, composante par composante
+static void Renderer_ToneMapSpan(
+    Renderer *renderer, const Vec4 *colors, int samples, Uint32 *pixels, int count)
+{
+    const int *shifts = renderer->m_colorShifts;
+    const Uint8 *lut = renderer->m_gammaLut;
+    float scale = renderer->m_exposure / (float)samples;
+
+    for (int i = 0; i < count; ++i)
+    {
+        int idx[4];
+        for (int c = 0; c < 4; ++c)
+        {
+            float sum = colors[i].data[c];
+            for (int s = 1; s < samples; ++s)
+            {
+                sum += colors[Renderer_GetSampleIndex(renderer, i, s)].data[c];
+            }
+
+            float x = (c < 3) ? sum * scale : sum * (1.0f / (float)samples);
+            x = (x > 0.0f) ? x : 0.0f;
+            float t = (c < 3) ? x / (x + 1.0f) : x;
+
+            // Inf / Inf = NaN pour une composante infinie : fminf() renvoie alors 1
+            t = fminf(t, 1.0f);
+            idx[c] = (int)(t * (float)(RENDERER_GAMMA_LUT_SIZE - 1) + 0.5f);
+        }
+
+        pixels[i] =
+            ((Uint32)lut[idx[0]] << shifts[0]) |
+            ((Uint32)lut[idx[1]] << shifts[1]) |
+            ((Uint32)lut[idx[2]] << shifts[2]) |
+            (Renderer_GetAlphaValue(idx[3]) << shifts[3]);
+    }
+}
+
+#endif
+
+/// @brief Écrit la couleur d'un pixel dans le buffer de couleur courant.
+static void Renderer_WriteColor(Renderer *renderer, size_t index, Vec4 color)
+{
+    if (renderer->m_hdr)
+    {
+        renderer->m_hdrPixels[index] = color;
+    }
+    else
+    {
+        renderer->m_pixels[index] = Renderer_PackColor(renderer, color);
+    }
+}
+
+void Renderer_SetSamples(
+    Renderer *renderer, int x, int y, unsigned sampleMask,
+    const float *zValues, Vec4 color, bool zWrite)
+{
+    size_t index = Renderer_GetIndex(renderer, x, y);
+    bool hdr = renderer->m_hdr;
+    Uint32 value = hdr ? 0 : Renderer_PackColor(renderer, color);
+    bool depth16 = (renderer->m_depthFormat == RENDERER_DEPTH_UNORM16);
+
+    for (int s = 0; s < RASTER_MSAA_SAMPLES; ++s)
+    {
+        if ((sampleMask & (1u << s)) == 0)
+            continue;
+
+        size_t i = Renderer_GetSampleIndex(renderer, index, s);
+        if (depth16)
+        {
+            // Le test est effectué sur les profondeurs arrondies
+            Uint16 depth = Renderer_EncodeDepth16(zValues[s]);
+            if (depth > renderer->m_sampleDepths16[i])
+                continue;
+            if (zWrite)
+            {
+                renderer->m_sampleDepths16[i] = depth;
+            }
+        }
+        else
+        {
+            if (!(zValues[s] <= renderer->m_sampleDepths[i]))
+                continue;
+            if (zWrite)
+            {
+                renderer->m_sampleDepths[i] = zValues[s];
+            }
+        }
+
+        if (hdr) renderer->m_hdrSampleColors[i] = color;
+        else renderer->m_sampleColors[i] = value;
+    }
+}
+
+/// @brief Lit un pixel regroupé pouvant être modifié par d'autres threads.
+static Uint64 Renderer_LoadPacked(const Uint64 *pixel)
+{
+#ifdef _MSC_VER
+    return *(const volatile Uint64 *)pixel;
+#else
+    return __atomic_load_n(pixel, __ATOMIC_RELAXED);
+#endif
+}
+
+/// @brief Remplace un pixel regroupé par desired s'il vaut encore *expected.
+/// En cas d'échec, *expected reçoit la valeur courante du pixel.
+/// @return true si le pixel a été remplacé.
+static bool Renderer_CompareExchangePacked(Uint64 *pixel, Uint64 *expected, Uint64 desired)
+{
+#ifdef _MSC_VER
+    __int64 previous = _InterlockedCompareExchange64(
+        (volatile __int64 *)pixel, (__int64)desired, (__int64)*expected);
+    bool success = ((Uint64)previous == *expected);
+    *expected = (Uint64)previous;
+    return success;
+#else
+    // Ordre relâché : les threads se synchronisent à la fin de la boucle parallèle
+    return __atomic_compare_exchange_n(
+        pixel, expected, desired, false, __ATOMIC_RELAXED, __ATOMIC_RELAXED);
+#endif
+}
+
+/// @brief Écrit un pixel regroupé (voir Renderer_BeginPackedWrites()) sans verrou.
+/// Le test de profondeur compare les mots entiers : à profondeur égale, la plus
+/// petite couleur est conservée, quel que soit l'ordre des écritures.
+static void Renderer_SetPackedPixel(
+    Renderer *renderer, size_t index, float zValue, Vec4 color, bool zWrite)
+{
+    Uint64 *pixel = renderer->m_packedPixels + index;
+    Uint64 key = Renderer_GetDepthKey(renderer, zValue);
+    Uint64 value = (key << 32) | Renderer_PackColor(renderer, color);
+    Uint64 expected = Renderer_LoadPacked(pixel);
+    long long retries = 0;
+
+    for (;;)
+    {
+        Uint64 desired = value;
+        if (zWrite)
+        {
+            if (value >= expected) break;
+        }
+        else
+        {
+            // Seule la couleur est modifiée, la profondeur est conservée
+            if (key > (expected >> 32)) break;
+            desired = (expected & 0xFFFFFFFF00000000ull) | (value & 0xFFFFFFFFull);
+            if (desired == expected) break;
+        }
+
+        if (Renderer_CompareExchangePacked(pixel, &expected, desired))
+        {
+            Renderer_GetThreadStats(renderer)->atomicWrites++;
+            break;
+        }
+        retries++;
+    }
+
+    if (retries > 0)
+    {
+        Renderer_GetThreadStats(renderer)->atomicRetries += retries;
+    }
+}
+
+void Renderer_BeginPackedWrites(Renderer *renderer)
+{
+    assert(renderer->m_packedPixels && !renderer->m_packedWrites);
+    assert(renderer->m_samples == 1 && !renderer->m_hdr);
+
+    Renderer_PrepareAllTiles(renderer);
+
+    SDL_Rect viewport = renderer->m_renderViewport;
+    bool depth16 = (renderer->m_depthFormat == RENDERER_DEPTH_UNORM16);
+
+    #pragma omp parallel for schedule(static)
+    for (int y = viewport.y; y < viewport.y + viewport.h; ++y)
+    {
+        for (int x = viewport.x; x < viewport.x + viewport.w; ++x)
+        {
+            size_t index = Renderer_GetIndex(renderer, x, y);
+            Uint64 key = depth16 ?
+                renderer->m_zBuffer16[index] :
+                Renderer_GetDepthKey(renderer, renderer->m_zBuffer[index]);
+            renderer->m_packedPixels[index] = (key << 32) | renderer->m_pixels[index];
+        }
+    }
+
+    renderer->m_packedWrites = true;
+}
+
+void Renderer_EndPackedWrites(Renderer *renderer)
+{
+    assert(renderer->m_packedWrites);
+
+    SDL_Rect viewport = renderer->m_renderViewport;
+    bool depth16 = (renderer->m_depthFormat == RENDERER_DEPTH_UNORM16);
+
+    #pragma omp parallel for schedule(static)
+    for (int y = viewport.y; y < viewport.y + viewport.h; ++y)
+    {
+        for (int x = viewport.x; x < viewport.x + viewport.w; ++x)
+        {
+            size_t index = Renderer_GetIndex(renderer, x, y);
+            Uint64 packed = renderer->m_packedPixels[index];
+            Uint32 key = (Uint32)(packed >> 32);
+            renderer->m_pixels[index] = (Uint32)packed;
+
+            if (depth16)
+            {
+                renderer->m_zBuffer16[index] = (Uint16)key;
+            }
+            else
+            {
+                // Inverse de Renderer_GetDepthKey()
+                Uint32 bits = (key & 0x80000000u) ? (key & 0x7FFFFFFFu) : ~key;
+                memcpy(renderer->m_zBuffer + index, &bits, sizeof(bits));
+            }
+        }
+    }
+
+    renderer->m_packedWrites = false;
+
+    // Le buffer de profondeur hiérarchique n'est pas mis à jour pendant les écritures
+    int bxmin = viewport.x / RASTER_BLOCK_SIZE;
+    int bymin = viewport.y / RASTER_BLOCK_SIZE;
+    int bxmax = (viewport.x + viewport.w - 1) / RASTER_BLOCK_SIZE;
+    int bymax = (viewport.y + viewport.h - 1) / RASTER_BLOCK_SIZE;
+
+    #pragma omp parallel for schedule(static)
+    for (int by = bymin; by <= bymax; ++by)
+    {
+        for (int bx = bxmin; bx <= bxmax; ++bx)
+        {
+            Renderer_UpdateHiZ(renderer, bx, by);
+        }
+    }
+}
+
+void Renderer_SetPixel(Renderer *renderer, int x, int y, float zValue, Vec4 color, bool zWrite)
+{
+    if (x < 0 || x >= renderer->m_width ||
+        y < 0 || y >= renderer->m_height)
+        return;
+
+    if (renderer->m_packedWrites)
+    {
+        Renderer_SetPackedPixel(
+            renderer, Renderer_GetIndex(renderer, x, y), zValue, color, zWrite);
+        return;
+    }
+
+    if (renderer->m_samples > 1)
+    {
+        // Tous les échantillons du pixel sont modifiés
+        float zValues[RASTER_MSAA_SAMPLES];
+        for (int s = 0; s < RASTER_MSAA_SAMPLES; ++s)
+        {
+            zValues[s] = zValue;
+        }
+        Renderer_SetSamples(
+            renderer, x, y, (1u << RASTER_MSAA_SAMPLES) - 1, zValues, color, zWrite);
+        return;
+    }
+
+    size_t index = Renderer_GetIndex(renderer, x, y);
+    if (renderer->m_depthFormat == RENDERER_DEPTH_UNORM16)
+    {
+        // Le test est effectué sur la profondeur arrondie
+        Uint16 depth = Renderer_EncodeDepth16(zValue);
+        if (depth <= renderer->m_zBuffer16[index])
+        {
+            Renderer_WriteColor(renderer, index, color);
+
+            if (zWrite)
+            {
+                renderer->m_zBuffer16[index] = depth;
+            }
+        }
+        return;
+    }
+
+    if (zValue <= renderer->m_zBuffer[index])
+    {
+        Renderer_WriteColor(renderer, index, color);
+
+        if (zWrite)
+        {
+            renderer->m_zBuffer[index] = zValue;
+        }
+    }
+}
+
+void Renderer_DrawLine(Renderer *renderer, Vec3 p0, Vec3 p1, Vec4 color, bool depthTest)
+{
+    Renderer_PrepareAllTiles(renderer);
+    Renderer_DrawLineRect(
+        renderer, p0, p1, color, depthTest,
+        0, 0, renderer->m_width - 1, renderer->m_height - 1);
+}
+
+void Renderer_DrawLineRect(
+    Renderer *renderer, Vec3 p0, Vec3 p1, Vec4 color, bool depthTest,
+    int xmin, int ymin, int xmax, int ymax)
+{
+    SDL_Rect viewport = renderer->m_renderViewport;
+
+    xmin = Int_Max(xmin, viewport.x);
+    ymin = Int_Max(ymin, viewport.y);
+    xmax = Int_Min(xmax, viewport.x + viewport.w - 1);
+    ymax = Int_Min(ymax, viewport.y + viewport.h - 1);
+    if (xmin > xmax || ymin > ymax)
+        return;
+
+    // Extrémités dans le repère raster (axe y vers le haut)
+    p0.z = Renderer_GetDepthValue(renderer, p0.z);
+    p1.z = Renderer_GetDepthValue(renderer, p1.z);
+    float x0 = viewport.x + viewport.w * (p0.x + 1.0f) / 2.0f;
+    float y0 = viewport.y + viewport.h * (p0.y + 1.0f) / 2.0f;
+    float x1 = viewport.x + viewport.w * (p1.x + 1.0f) / 2.0f;
+    float y1 = viewport.y + viewport.h * (p1.y + 1.0f) / 2.0f;
+
+    // Le segment est parcouru selon son axe principal u, une colonne de pixels
+    // à la fois (algorithme DDA). Les extrémités sont ordonnées selon u : une
+    // arête partagée par deux triangles donne exactement les mêmes pixels
+    bool steep = fabsf(y1 - y0) > fabsf(x1 - x0);
+    float u0 = steep ? y0 : x0, v0 = steep ? x0 : y0, z0 = p0.z;
+    float u1 = steep ? y1 : x1, v1 = steep ? x1 : y1, z1 = p1.z;
+    if (u1 < u0 || (u1 == u0 && v1 < v0))
+    {
+        float tmp;
+        tmp = u0; u0 = u1; u1 = tmp;
+        tmp = v0; v0 = v1; v1 = tmp;
+        tmp = z0; z0 = z1; z1 = tmp;
+    }
+    int umin = steep ? ymin : xmin, umax = steep ? ymax : xmax;
+    int vmin = steep ? xmin : ymin, vmax = steep ? xmax : ymax;
+
+    float du = u1 - u0;
+    float slope = (du > 0.0f) ? (v1 - v0) / du : 0.0f;
+    float zSlope = (du > 0.0f) ? (z1 - z0) / du : 0.0f;
+
+    // Découpage par le rectangle avant le parcours : colonnes du segment
+    // dont la coordonnée v est dans le rectangle (à un pixel près)
+    float first = fmaxf(floorf(u0), (float)umin);
+    float last = fminf(floorf(u1), (float)umax);
+    if (slope != 0.0f)
+    {
+        float ua = u0 + ((float)vmin - v0) / slope;
+        float ub = u0 + ((float)vmax + 1.0f - v0) / slope;
+        first = fmaxf(first, floorf(fminf(ua, ub)) - 1.0f);
+        last = fminf(last, floorf(fmaxf(ua, ub)) + 1.0f);
+    }
+
+    for (int u = (int)first; u <= (int)last; ++u)
+    {
+        // Point du segment au centre de la colonne
+        float t = Float_Clamp(u + 0.5f, u0, u1) - u0;
+        int v = (int)floorf(v0 + t * slope);
+        if (v < vmin || v > vmax)
+            continue;
+
+        // Sans test de profondeur, la ligne est toujours visible (zValue = -2.0f)
+        float z = depthTest ? z0 + t * zSlope - RENDERER_LINE_DEPTH_BIAS : -2.0f;
+        Renderer_SetPixel(renderer, steep ? v : u, steep ? u : v, z, color, false);
+    }
+}
+
+void Renderer_ResetDepthBuffer(Renderer *renderer)
+{
+    int tileCount = TileBins_GetTileCount(renderer->m_tileBins);
+    for (int i = 0; i < tileCount; ++i)
+    {
+        renderer->m_tileClearFlags[i] |= RENDERER_CLEAR_DEPTH;
+    }
+}
+
+/// @brief Zone contiguë des buffers du moteur de rendu.
+typedef struct RendererSpan_s
+{
+    /// @brief Indice du premier pixel.
+    size_t start;
+
+    /// @brief Nombre de pixels.
+    int count;
+} RendererSpan;
+
+/// @brief Nombre maximal de zones contiguës d'une tuile : une par ligne
+/// ou une par bloc selon le rangement.
+#define RENDERER_MAX_TILE_SPANS \
+    (TILE_SIZE + (TILE_SIZE / RASTER_BLOCK_SIZE) * (TILE_SIZE / RASTER_BLOCK_SIZE))
+
+/// @brief Calcule les zones contiguës des buffers couvrant une tuile.
+/// Avec un rangement par blocs, les blocs au bord de l'image sont entiers
+/// (pixels de complément compris).
+/// @param[out] spans les zones de la tuile (au plus RENDERER_MAX_TILE_SPANS).
+/// @return Le nombre de zones.
+static int Renderer_GetTileSpans(Renderer *renderer, int tileIndex, RendererSpan *spans)
+{
+    int tileCountX = renderer->m_tileBins->m_tileCountX;
+    int xmin = (tileIndex % tileCountX) * TILE_SIZE;
+    int ymin = (tileIndex / tileCountX) * TILE_SIZE;
+    int xmax = Int_Min(xmin + TILE_SIZE, renderer->m_width) - 1;
+    int ymax = Int_Min(ymin + TILE_SIZE, renderer->m_height) - 1;
+    int count = 0;
+
+    if (renderer->m_layout == RENDERER_LAYOUT_LINEAR)
+    {
+        for (int y = ymin; y <= ymax; ++y)
+        {
+            spans[count].start = Renderer_GetIndex(renderer, xmin, y);
+            spans[count].count = xmax - xmin + 1;
+            count++;
+        }
+    }
+    else
+    {
+        // TILE_SIZE est un multiple de RASTER_BLOCK_SIZE
+        for (int y = ymin; y <= ymax; y += RASTER_BLOCK_SIZE)
+        {
+            for (int x = xmin; x <= xmax; x += RASTER_BLOCK_SIZE)
+            {
+                spans[count].start = Renderer_GetIndex(renderer, x, y);
+                spans[count].count = RASTER_BLOCK_SIZE * RASTER_BLOCK_SIZE;
+                count++;
+            }
+        }
+    }
+
+    assert(count <= RENDERER_MAX_TILE_SPANS);
+    return count;
+}
+
+/// @brief Remplit un tableau de couleurs, par 8 (AVX2) ou 4 (SSE2) valeurs.
+static void Renderer_FillColors(Uint32 *colors, size_t count, Uint32 value)
+{
+    size_t i = 0;
+
+#if defined(RASTER_KERNEL_AVX2)
+    const __m256i values = _mm256_set1_epi32((int)value);
+    for (; i + 8 <= count; i += 8)
+    {
+        _mm256_storeu_si256((__m256i *)(colors + i), values);
+    }
+#elif defined(RASTER_KERNEL_SSE2)
+    const __m128i values = _mm_set1_epi32((int)value);
+    for (; i + 4 <= count; i += 4)
+    {
+        _mm_storeu_si128((__m128i *)(colors + i), values);
+    }
+#endif
+
+    for (; i < count; ++i)
+    {
+        colors[i] = value;
+    }
+}
+
+/// @brief Remplit un tableau de profondeurs, par 8 (AVX2) ou 4 (SSE2) valeurs.
+static void Renderer_FillDepths(float *depths, size_t count, float value)
+{
+    size_t i = 0;
+
+#if defined(RASTER_KERNEL_AVX2)
+    const __m256 values = _mm256_set1_ps(value);
+    for (; i + 8 <= count; i += 8)
+    {
+        _mm256_storeu_ps(depths + i, values);
+    }
+#elif defined(RASTER_KERNEL_SSE2)
+    const __m128 values = _mm_set1_ps(value);
+    for (; i + 4 <= count; i += 4)
+    {
+        _mm_storeu_ps(depths + i, values);
+    }
+#endif
+
+    for (; i < count; ++i)
+    {
+        depths[i] = value;
+    }
+}
+
+void Renderer_PrepareTile(Renderer *renderer, int tileIndex)
+{
+    Uint8 flags = renderer->m_tileClearFlags[tileIndex];
+    if (flags == 0)
+        return;
+
+    RendererSpan spans[RENDERER_MAX_TILE_SPANS];
+    int spanCount = Renderer_GetTileSpans(renderer, tileIndex, spans);
+    int samples = renderer->m_samples;
+
+    if (flags & RENDERER_CLEAR_DEPTH)
+    {
+        // En MSAA, le span est effacé dans le plan de chaque échantillon
+        for (int i = 0; i < spanCount * samples; ++i)
+        {
+            size_t start = Renderer_GetSampleIndex(
+                renderer, spans[i % spanCount].start, i / spanCount);
+            size_t count = (size_t)spans[i % spanCount].count;
+
+            if (renderer->m_depthFormat == RENDERER_DEPTH_UNORM16)
+            {
+                // Profondeur maximale 0xFFFF : les points sur le plan far restent visibles
+                Uint16 *depths = (samples > 1) ? renderer->m_sampleDepths16 : renderer->m_zBuffer16;
+                memset(depths + start, 0xFF, count * sizeof(Uint16));
+            }
+            else
+            {
+                // Les points entres les plans near et far ont une profondeur dans [-1.0f, 1.0f]
+                // (dans [-1.0f, 0.0f] en reverse-Z)
+                float *depths = (samples > 1) ? renderer->m_sampleDepths : renderer->m_zBuffer;
+                Renderer_FillDepths(depths + start, count, 2.f);
+            }
+        }
+
+        // Blocs du buffer hiérarchique contenus dans la tuile
+        int tileCountX = renderer->m_tileBins->m_tileCountX;
+        int bxmin = (tileIndex % tileCountX) * (TILE_SIZE / RASTER_BLOCK_SIZE);
+        int bymin = (tileIndex / tileCountX) * (TILE_SIZE / RASTER_BLOCK_SIZE);
+        int bxmax = Int_Min(bxmin + TILE_SIZE / RASTER_BLOCK_SIZE, renderer->m_hiZWidth);
+        int bymax = Int_Min(bymin + TILE_SIZE / RASTER_BLOCK_SIZE, renderer->m_hiZHeight);
+        for (int by = bymin; by < bymax; ++by)
+        {
+            for (int bx = bxmin; bx < bxmax; ++bx)
+            {
+                renderer->m_hiZ[by * renderer->m_hiZWidth + bx] = 2.f;
+            }
+        }
+    }
+
+    if ((flags & RENDERER_CLEAR_COLOR) && renderer->m_hdr)
+    {
+        Vec4 *colors = (samples > 1) ? renderer->m_hdrSampleColors : renderer->m_hdrPixels;
+        for (int i = 0; i < spanCount * samples; ++i)
+        {
+            Vec4 *dst = colors + Renderer_GetSampleIndex(
+                renderer, spans[i % spanCount].start, i / spanCount);
+            size_t count = (size_t)spans[i % spanCount].count;
+            for (size_t j = 0; j < count; ++j)
+            {
+                dst[j] = renderer->m_clearValue;
+            }
+        }
+    }
+    else if (flags & RENDERER_CLEAR_COLOR)
+    {
+        // En MSAA, les couleurs des pixels sont calculées par le resolve
+        Uint32 *colors = (samples > 1) ? renderer->m_sampleColors : renderer->m_pixels;
+        for (int i = 0; i < spanCount * samples; ++i)
+        {
+            Renderer_FillColors(
+                colors + Renderer_GetSampleIndex(
+                    renderer, spans[i % spanCount].start, i / spanCount),
+                (size_t)spans[i % spanCount].count, renderer->m_clearColor);
+        }
+    }
+
+    renderer->m_tileClearFlags[tileIndex] = 0;
+}
+
+void Renderer_PrepareAllTiles(Renderer *renderer)
+{
+    int tileCount = TileBins_GetTileCount(renderer->m_tileBins);
+
+    #pragma omp parallel for schedule(static)
+    for (int i = 0; i < tileCount; ++i)
+    {
+        Renderer_PrepareTile(renderer, i);
+    }
+}
+
+/// @brief Renvoie la profondeur maximale d'une zone contiguë du buffer de
+/// profondeur. En MSAA, la zone est parcourue simultanément dans le plan de
+/// chaque échantillon (voir Renderer_GetSampleIndex()).
+/// @param start l'indice de la première valeur.
+/// @param count le nombre de valeurs.
+static float Renderer_GetMaxDepth(Renderer *renderer, size_t start, int count)
+{
+    bool multisample = (renderer->m_samples > 1);
+    size_t plane = renderer->m_samplePlaneSize;
+
+    // Les profondeurs ne sont jamais NaN, la comparaison simple permet la vectorisation
+    if (renderer->m_depthFormat == RENDERER_DEPTH_UNORM16)
+    {
+        Uint16 zmax = 0;
+        if (multisample)
+        {
+            const Uint16 *depths = renderer->m_sampleDepths16 + start;
+            for (int i = 0; i < count; ++i)
+            {
+                for (int s = 0; s < RASTER_MSAA_SAMPLES; ++s)
+                {
+                    Uint16 depth = depths[s * plane + i];
+                    zmax = (depth > zmax) ? depth : zmax;
+                }
+            }
+        }
+        else
+        {
+            const Uint16 *depths = renderer->m_zBuffer16 + start;
+            for (int i = 0; i < count; ++i)
+            {
+                zmax = (depths[i] > zmax) ? depths[i] : zmax;
+            }
+        }
+        return Renderer_DecodeDepth16(zmax);
+    }
+
+    float zmax = -INFINITY;
+    if (multisample)
+    {
+        const float *depths = renderer->m_sampleDepths + start;
+        for (int i = 0; i < count; ++i)
+        {
+            for (int s = 0; s < RASTER_MSAA_SAMPLES; ++s)
+            {
+                float depth = depths[s * plane + i];
+                zmax = (depth > zmax) ? depth : zmax;
+            }
+        }
+    }
+    else
+    {
+        const float *depths = renderer->m_zBuffer + start;
+        for (int i = 0; i < count; ++i)
+        {
+            zmax = (depths[i] > zmax) ? depths[i] : zmax;
+        }
+    }
+    return zmax;
+}
+
+void Renderer_UpdateHiZ(Renderer *renderer, int bx, int by)
+{
+    int xmin = bx * RASTER_BLOCK_SIZE;
+    int ymin = by * RASTER_BLOCK_SIZE;
+    int xmax = Int_Min(xmin + RASTER_BLOCK_SIZE, renderer->m_width) - 1;
+    int ymax = Int_Min(ymin + RASTER_BLOCK_SIZE, renderer->m_height) - 1;
+
+    // Profondeurs des pixels, ou des échantillons en MSAA
+    bool full = (xmax - xmin + 1 == RASTER_BLOCK_SIZE) && (ymax - ymin + 1 == RASTER_BLOCK_SIZE);
+
+    float zmax = -INFINITY;
+    if (renderer->m_layout != RENDERER_LAYOUT_LINEAR && full)
+    {
+        // Le bloc occupe une zone contiguë des buffers
+        zmax = Renderer_GetMaxDepth(
+            renderer, Renderer_GetIndex(renderer, xmin, ymin),
+            RASTER_BLOCK_SIZE * RASTER_BLOCK_SIZE);
+    }
+    else if (renderer->m_layout == RENDERER_LAYOUT_LINEAR)
+    {
+        // Chaque ligne du bloc est contiguë
+        int count = xmax - xmin + 1;
+        for (int y = ymin; y <= ymax; ++y)
+        {
+            zmax = fmaxf(zmax, Renderer_GetMaxDepth(
+                renderer, Renderer_GetIndex(renderer, xmin, y), count));
+        }
+    }
+    else
+    {
+        // Bloc au bord de l'image : seuls les pixels de l'image sont parcourus
+        for (int y = ymin; y <= ymax; ++y)
+        {
+            for (int x = xmin; x <= xmax; ++x)
+            {
+                zmax = fmaxf(zmax, Renderer_GetMaxDepth(
+                    renderer, Renderer_GetIndex(renderer, x, y), 1));
+            }
+        }
+    }
+
+    renderer->m_hiZ[by * renderer->m_hiZWidth + bx] = zmax;
+}
+
+void Renderer_Fill(Renderer *renderer, Vec4 color)
+{
+    renderer->m_clearColor = Renderer_PackColor(renderer, color);
+    renderer->m_clearValue = color;
+
+    int tileCount = TileBins_GetTileCount(renderer->m_tileBins);
+    for (int i = 0; i < tileCount; ++i)
+    {
+        renderer->m_tileClearFlags[i] |= RENDERER_CLEAR_COLOR;
+    }
+}
+
+/// @brief Calcule la couleur de pixels comme la moyenne des couleurs
+/// de leurs échantillons (MSAA).
+static void Renderer_ResolveSpan(Renderer *renderer, size_t start, int count)
+{
+    // Le span est contigu dans le plan de chaque échantillon
+    const Uint32 *planes[RASTER_MSAA_SAMPLES];
+    for (int s = 0; s < RASTER_MSAA_SAMPLES; ++s)
+    {
+        planes[s] = renderer->m_sampleColors + Renderer_GetSampleIndex(renderer, start, s);
+    }
+
+    Uint32 *pixels = renderer->m_pixels + start;
+    for (int i = 0; i < count; ++i)
+    {
+        // Moyenne des RASTER_MSAA_SAMPLES = 4 échantillons : les composantes
+        // paires et impaires sont sommées séparément, deux par deux sur 16 bits
+        // (la somme de 4 octets tient sur 10 bits)
+        Uint32 even = 0x00020002;
+        Uint32 odd = 0x00020002;
+        for (int s = 0; s < RASTER_MSAA_SAMPLES; ++s)
+        {
+            Uint32 color = planes[s][i];
+            even += color & 0x00FF00FF;
+            odd += (color >> 8) & 0x00FF00FF;
+        }
+        pixels[i] = ((even >> 2) & 0x00FF00FF) | (((odd >> 2) & 0x00FF00FF) << 8);
+    }
+}
+
+/// @brief Calcule la couleur finale des pixels avant leur copie dans la texture.
+/// Les tuiles dont le remplissage est en attente reçoivent la couleur d'effacement,
+/// sans lecture de leurs buffers. En MSAA, les pixels des autres tuiles sont
+/// obtenus en moyennant leurs échantillons (resolve). En HDR, leurs couleurs
+/// sont converties en une seule passe (voir Renderer_ToneMapSpan()).
+static void Renderer_ResolveTiles(Renderer *renderer)
+{
+    int tileCount = TileBins_GetTileCount(renderer->m_tileBins);
+    int tileCountX = renderer->m_tileBins->m_tileCountX;
+    int samples = renderer->m_samples;
+    bool multisample = (samples > 1);
+    bool hdr = renderer->m_hdr;
+
+    Uint32 clearColor = renderer->m_clearColor;
+    if (hdr)
+    {
+        Renderer_ToneMapSpan(renderer, &(renderer->m_clearValue), 1, &clearColor, 1);
+    }
+
+    #pragma omp parallel for schedule(static)
+    for (int i = 0; i < tileCount; ++i)
+    {
+        bool pending = (renderer->m_tileClearFlags[i] & RENDERER_CLEAR_COLOR) != 0;
+        if (!pending && !multisample && !hdr)
+            continue;
+
+        // À résolution réduite, seules les tuiles de l'image rendue sont utilisées
+        if ((i % tileCountX) * TILE_SIZE >= renderer->m_renderWidth ||
+            (i / tileCountX) * TILE_SIZE >= renderer->m_renderHeight)
+            continue;
+
+        RendererSpan spans[RENDERER_MAX_TILE_SPANS];
+        int spanCount = Renderer_GetTileSpans(renderer, i, spans);
+        for (int j = 0; j < spanCount; ++j)
+        {
+            size_t start = spans[j].start;
+            if (pending)
+            {
+                Renderer_FillColors(renderer->m_pixels + start, spans[j].count, clearColor);
+            }
+            else if (hdr)
+            {
+                const Vec4 *colors = multisample ?
+                    renderer->m_hdrSampleColors + start :
+                    renderer->m_hdrPixels + start;
+                Renderer_ToneMapSpan(
+                    renderer, colors, samples, renderer->m_pixels + start, spans[j].count);
+            }
+            else
+            {
+                Renderer_ResolveSpan(renderer, start, spans[j].count);
+            }
+        }
+
+        // Sans MSAA ni HDR, les couleurs de la tuile sont désormais initialisées.
+        // Sinon, celles des échantillons ou des pixels HDR restent en attente.
+        if (pending && !multisample && !hdr)
+        {
+            renderer->m_tileClearFlags[i] &= ~RENDERER_CLEAR_COLOR;
+        }
+    }
+}
+
+/// @brief Copie les pixels dans un framebuffer, ligne par ligne (axe y vers le bas).
+static void Renderer_Linearize(Renderer *renderer, Uint32 *frame)
+{
+    int width = renderer->m_width;
+    int height = renderer->m_height;
+
+    #pragma omp parallel for schedule(static)
+    for (int row = 0; row < height; ++row)
+    {
+        int y = height - 1 - row;
+        Uint32 *dst = frame + (size_t)row * width;
+
+        if (renderer->m_layout == RENDERER_LAYOUT_LINEAR)
+        {
+            memcpy(dst, renderer->m_pixels + Renderer_GetIndex(renderer, 0, y), width * sizeof(Uint32));
+        }
+        else if (renderer->m_layout == RENDERER_LAYOUT_TILED)
+        {
+            // Chaque ligne d'un bloc est contiguë
+            for (int x = 0; x < width; x += RASTER_BLOCK_SIZE)
+            {
+                const Uint32 *src = renderer->m_pixels + Renderer_GetIndex(renderer, x, y);
+                int count = Int_Min(RASTER_BLOCK_SIZE, width - x);
+                memcpy(dst + x, src, count * sizeof(Uint32));
+            }
+        }
+        else
+        {
+            for (int x = 0; x < width; ++x)
+            {
+                dst[x] = renderer->m_pixels[Renderer_GetIndex(renderer, x, y)];
+            }
+        }
+    }
+}
+
+/// @brief Mélange deux couleurs 8 bits par composante.
+/// @param weight le poids de la seconde couleur, entre 0 et 256.
+static Uint32 Renderer_LerpColor(Uint32 a, Uint32 b, Uint32 weight)
+{
+    // Les composantes paires et impaires sont mélangées deux par deux sur 16 bits
+    Uint32 even = ((a & 0x00FF00FF) * (256 - weight) + (b & 0x00FF00FF) * weight) >> 8;
+    Uint32 odd = (((a >> 8) & 0x00FF00FF) * (256 - weight) + ((b >> 8) & 0x00FF00FF) * weight) >> 8;
+    return (even & 0x00FF00FF) | ((odd & 0x00FF00FF) << 8);
+}
+
+/// @brief Renvoie un pixel de l'image agrandie par interpolation bilinéaire
+/// de l'image rendue à la résolution interne (voir Renderer_SetResolutionScale()).
+static Uint32 Renderer_GetUpscaledPixel(
+    Renderer *renderer, const RendererUpscaleTap *column, const RendererUpscaleTap *row)
+{
+    const Uint32 *pixels = renderer->m_pixels;
+    Uint32 c00 = pixels[Renderer_GetIndex(renderer, column->p0, row->p0)];
+    Uint32 c01 = pixels[Renderer_GetIndex(renderer, column->p1, row->p0)];
+    Uint32 c10 = pixels[Renderer_GetIndex(renderer, column->p0, row->p1)];
+    Uint32 c11 = pixels[Renderer_GetIndex(renderer, column->p1, row->p1)];
+
+    return Renderer_LerpColor(
+        Renderer_LerpColor(c00, c01, column->weight),
+        Renderer_LerpColor(c10, c11, column->weight), row->weight);
+}
+
+/// @brief Agrandit l'image rendue à la résolution interne aux dimensions de l'image
+/// et la copie dans un framebuffer, ligne par ligne (axe y vers le bas).
+static void Renderer_Upscale(Renderer *renderer, Uint32 *frame)
+{
+    int width = renderer->m_width;
+    int height = renderer->m_height;
+
+    #pragma omp parallel for schedule(static)
+    for (int row = 0; row < height; ++row)
+    {
+        RendererUpscaleTap tap = Renderer_GetUpscaleTap(
+            height - 1 - row, height, renderer->m_renderHeight);
+        Uint32 *dst = frame + (size_t)row * width;
+
+        for (int x = 0; x < width; ++x)
+        {
+            dst[x] = Renderer_GetUpscaledPixel(renderer, renderer->m_upscaleColumns + x, &tap);
+        }
+    }
+}
+
+/// @brief Copie une image rangée ligne par ligne dans la texture et la présente.
+/// @param pixels l'image, ou NULL si elle est déjà dans la texture (rendu direct).
+/// @param pitch le nombre de pixels séparant deux lignes de l'image.
+static void Renderer_PresentFrame(Renderer *renderer, const Uint32 *pixels, int pitch)
+{
+    SDL_Texture *texture = renderer->m_streamTex;
+    Uint64 start = SDL_GetPerformanceCounter();
+
+    if (pixels)
+    {
+        SDL_UpdateTexture(texture, NULL, pixels, pitch * (int)sizeof(Uint32));
+    }
+    SDL_RenderCopy(renderer->m_rendererSDL, texture, NULL, NULL);
+    SDL_RenderPresent(renderer->m_rendererSDL);
+
+    double presentTime = (double)(SDL_GetPerformanceCounter() - start)
+        / (double)SDL_GetPerformanceFrequency();
+
+    SDL_LockMutex(renderer->m_presentMutex);
+    renderer->m_presentStats.presentTime += presentTime;
+    SDL_UnlockMutex(renderer->m_presentMutex);
+}
+
+/// @brief Renvoie un framebuffer dans un état donné, ou -1 si aucun framebuffer
+/// n'est dans cet état. Doit être appelée en possédant m_presentMutex.
+static int Renderer_FindFrame(Renderer *renderer, RendererFrameState state)
+{
+    for (int i = 0; i < RENDERER_MAX_FRAMES; ++i)
+    {
+        if (renderer->m_frameStates[i] == state)
+            return i;
+    }
+    return -1;
+}
+
+/// @brief Présente sur le thread appelant l'image en attente.
+/// @return true si une image a été présentée.
+static bool Renderer_PresentQueuedFrame(Renderer *renderer)
+{
+    SDL_LockMutex(renderer->m_presentMutex);
+    int frame = Renderer_FindFrame(renderer, RENDERER_FRAME_QUEUED);
+    if (frame < 0)
+    {
+        SDL_UnlockMutex(renderer->m_presentMutex);
+        return false;
+    }
+
+    // La copie dans la texture et l'attente de la synchronisation verticale
+    // ont lieu sans verrou, pendant le calcul de l'image suivante
+    renderer->m_frameStates[frame] = RENDERER_FRAME_PRESENTING;
+    SDL_UnlockMutex(renderer->m_presentMutex);
+
+    Renderer_PresentFrame(renderer, renderer->m_frames[frame], renderer->m_width);
+
+    SDL_LockMutex(renderer->m_presentMutex);
+    renderer->m_frameStates[frame] = RENDERER_FRAME_FREE;
+    renderer->m_presentStats.framesPresented++;
+    SDL_CondBroadcast(renderer->m_presentCond);
+    SDL_UnlockMutex(renderer->m_presentMutex);
+
+    return true;
+}
+
+/// @brief Fonction du thread de rendu : calcule les images confiées par
+/// Renderer_RenderFrame() jusqu'à la demande d'arrêt.
+static int Renderer_RenderThread(void *data)
+{
+    Renderer *renderer = (Renderer *)data;
+
+    SDL_LockMutex(renderer->m_presentMutex);
+    while (true)
+    {
+        if (!renderer->m_renderPending)
+        {
+            if (renderer->m_renderQuit)
+                break;
+
+            SDL_CondWait(renderer->m_presentCond, renderer->m_presentMutex);
+            continue;
+        }
+        SDL_UnlockMutex(renderer->m_presentMutex);
+
+        renderer->m_renderFunc(renderer->m_renderData);
+
+        SDL_LockMutex(renderer->m_presentMutex);
+        renderer->m_renderPending = false;
+        SDL_CondBroadcast(renderer->m_presentCond);
+    }
+    SDL_UnlockMutex(renderer->m_presentMutex);
+
+    return 0;
+}
+
+/// @brief Arrête le thread de rendu puis présente l'image en attente.
+static void Renderer_StopRenderThread(Renderer *renderer)
+{
+    if (!renderer->m_renderThread)
+        return;
+
+    SDL_LockMutex(renderer->m_presentMutex);
+    renderer->m_renderQuit = true;
+    SDL_CondBroadcast(renderer->m_presentCond);
+    SDL_UnlockMutex(renderer->m_presentMutex);
+
+    SDL_WaitThread(renderer->m_renderThread, NULL);
+    renderer->m_renderThread = NULL;
+    renderer->m_renderQuit = false;
+
+    Renderer_PresentQueuedFrame(renderer);
+}
+
+/// @brief Réserve un framebuffer libre pour l'image courante en présentation asynchrone.
+/// L'autre framebuffer contient au plus l'image précédente, en attente ou en
+/// cours de présentation (voir Renderer_RenderFrame()) : aucune attente n'est nécessaire.
+/// @return L'indice du framebuffer réservé.
+static int Renderer_AcquireFrame(Renderer *renderer)
+{
+    SDL_LockMutex(renderer->m_presentMutex);
+    renderer->m_presentStats.framesRendered++;
+
+    int frame = Renderer_FindFrame(renderer, RENDERER_FRAME_FREE);
+    assert(frame >= 0);
+
+    renderer->m_frameStates[frame] = RENDERER_FRAME_WRITING;
+    SDL_UnlockMutex(renderer->m_presentMutex);
+
+    return frame;
+}
+
+void Renderer_Update(Renderer *renderer)
+{
+    Renderer_ResolveTiles(renderer);
+
+    // Les taux d'ombrage de l'image suivante dépendent de celle-ci
+    if (renderer->m_shadingMode == RENDERER_SHADING_CONTENT)
+    {
+        Renderer_UpdateContentRates(renderer);
+    }
+
+    // Durée du calcul de l'image, moyennée sur les dernières images
+    float frameTime = (float)(SDL_GetPerformanceCounter() - renderer->m_frameStart)
+        / (float)SDL_GetPerformanceFrequency();
+    renderer->m_frameTime = (renderer->m_frameTime > 0.0f) ?
+        renderer->m_frameTime + 0.25f * (frameTime - renderer->m_frameTime) : frameTime;
+
+    bool upscaled = Renderer_IsUpscaled(renderer);
+
+    if (!renderer->m_rendererSDL)
+    {
+        // Rendu hors écran : l'image reste dans les buffers (voir Renderer_ReadPixels())
+        renderer->m_presentStats.framesRendered++;
+        return;
+    }
+
+    if (renderer->m_presentMode == RENDERER_PRESENT_SYNC)
+    {
+        if (renderer->m_textureLocked)
+        {
+            // Rendu direct : l'image est déjà dans la texture
+            Renderer_ReleaseTexture(renderer);
+            Renderer_PresentFrame(renderer, NULL, 0);
+        }
+        else if (upscaled)
+        {
+            Renderer_Upscale(renderer, renderer->m_frames[0]);
+            Renderer_PresentFrame(renderer, renderer->m_frames[0], renderer->m_width);
+        }
+        else if (renderer->m_layout != RENDERER_LAYOUT_LINEAR)
+        {
+            Renderer_Linearize(renderer, renderer->m_frames[0]);
+            Renderer_PresentFrame(renderer, renderer->m_frames[0], renderer->m_width);
+        }
+        else
+        {
+            Renderer_PresentFrame(renderer, renderer->m_pixels, renderer->m_pitch);
+        }
+
+        renderer->m_presentStats.framesRendered++;
+        renderer->m_presentStats.framesPresented++;
+        return;
+    }
+
+    // Les buffers de rendu sont copiés : le rendu de l'image suivante peut
+    // commencer pendant la présentation
+    int frame = Renderer_AcquireFrame(renderer);
+    if (upscaled)
+    {
+        Renderer_Upscale(renderer, renderer->m_frames[frame]);
+    }
+    else
+    {
+        Renderer_Linearize(renderer, renderer->m_frames[frame]);
+    }
+
+    SDL_LockMutex(renderer->m_presentMutex);
+    renderer->m_frameStates[frame] = RENDERER_FRAME_QUEUED;
+    bool direct = !renderer->m_renderPending;
+    SDL_CondBroadcast(renderer->m_presentCond);
+    SDL_UnlockMutex(renderer->m_presentMutex);
+
+    // Appel hors de Renderer_RenderFrame() : le thread appelant est celui de
+    // la fenêtre et aucun autre ne présentera l'image
+    if (direct)
+    {
+        Renderer_PresentQueuedFrame(renderer);
+    }
+}
+
+void Renderer_RenderFrame(Renderer *renderer, RendererFrameFunc *render, void *data)
+{
+    if (!renderer->m_renderThread)
+    {
+        render(data);
+        return;
+    }
+
+    SDL_LockMutex(renderer->m_presentMutex);
+    renderer->m_renderFunc = render;
+    renderer->m_renderData = data;
+    renderer->m_renderPending = true;
+    SDL_CondBroadcast(renderer->m_presentCond);
+    SDL_UnlockMutex(renderer->m_presentMutex);
+
+    // Présente l'image précédente pendant le calcul de celle-ci
+    Renderer_PresentQueuedFrame(renderer);
+
+    // La scène ne doit plus être lue par le thread de rendu au retour
+    SDL_LockMutex(renderer->m_presentMutex);
+    if (renderer->m_renderPending)
+    {
+        RendererPresentStats *stats = &(renderer->m_presentStats);
+        Uint64 start = SDL_GetPerformanceCounter();
+
+        while (renderer->m_renderPending)
+        {
+            SDL_CondWait(renderer->m_presentCond, renderer->m_presentMutex);
+        }
+        stats->framesStalled++;
+        stats->stallTime += (double)(SDL_GetPerformanceCounter() - start)
+            / (double)SDL_GetPerformanceFrequency();
+    }
+    SDL_UnlockMutex(renderer->m_presentMutex);
+}
+
+int Renderer_SetPresentMode(Renderer *renderer, RendererPresentMode mode)
+{
+    assert(mode >= 0 && mode < RENDERER_PRESENT_MODE_COUNT);
+
+    // Présente l'image en attente avec l'ancien mode
+    Renderer_ReleaseTexture(renderer);
+    Renderer_StopRenderThread(renderer);
+    renderer->m_presentMode = RENDERER_PRESENT_SYNC;
+
+    if (mode == RENDERER_PRESENT_SYNC)
+        return EXIT_SUCCESS;
+
+    // Sans fenêtre, il n'y a rien à présenter
+    if (!renderer->m_rendererSDL) goto ERROR_LABEL;
+
+    int exitStatus = Renderer_AllocateFrames(renderer, RENDERER_MAX_FRAMES);
+    if (exitStatus != EXIT_SUCCESS) goto ERROR_LABEL;
+
+    for (int i = 0; i < RENDERER_MAX_FRAMES; ++i)
+    {
+        renderer->m_frameStates[i] = RENDERER_FRAME_FREE;
+    }
+    renderer->m_presentMode = mode;
+
+    renderer->m_renderThread = SDL_CreateThread(Renderer_RenderThread, "Render", renderer);
+    if (!renderer->m_renderThread)
+    {
+        printf("SDL_CreateThread Error: %s\n", SDL_GetError());
+        renderer->m_presentMode = RENDERER_PRESENT_SYNC;
+        goto ERROR_LABEL;
+    }
+
+    return EXIT_SUCCESS;
+
+ERROR_LABEL:
+    printf("ERROR - Renderer_SetPresentMode()\n");
+    assert(false);
+    return EXIT_FAILURE;
+}
+
+RendererPresentStats Renderer_GetPresentStats(Renderer *renderer)
+{
+    SDL_LockMutex(renderer->m_presentMutex);
+    RendererPresentStats stats = renderer->m_presentStats;
+    SDL_UnlockMutex(renderer->m_presentMutex);
+
+    return stats;
+}
+
+void Renderer_ReadPixels(Renderer *renderer, Uint8 *pixels, int pitch)
+{
+    int width = renderer->m_width;
+    int height = renderer->m_height;
+    const int *shifts = renderer->m_colorShifts;
+    bool upscaled = Renderer_IsUpscaled(renderer);
+
+    #pragma omp parallel for schedule(static)
+    for (int row = 0; row < height; ++row)
+    {
+        int y = height - 1 - row;
+        RendererUpscaleTap tap = Renderer_GetUpscaleTap(y, height, renderer->m_renderHeight);
+        Uint8 *dst = pixels + (size_t)row * pitch;
+        for (int x = 0; x < width; ++x)
+        {
+            Uint32 value = upscaled ?
+                Renderer_GetUpscaledPixel(renderer, renderer->m_upscaleColumns + x, &tap) :
+                renderer->m_pixels[Renderer_GetIndex(renderer, x, y)];
+            for (int c = 0; c < 4; ++c)
+            {
+                dst[4 * x + c] = (Uint8)(value >> shifts[c]);
+            }
+        }
+    }
+}
+
+int Renderer_SavePPM(Renderer *renderer, const char *path)
+{
+    int width = renderer->m_width;
+    int height = renderer->m_height;
+    Uint8 *pixels = NULL;
+    FILE *file = NULL;
+
+    pixels = (Uint8 *)malloc((size_t)width * height * 4);
+    if (!pixels) goto ERROR_LABEL;
+
+    Renderer_ReadPixels(renderer, pixels, width * 4);
+
+    // Format binaire P6 : composantes RGB sans alpha
+    for (size_t i = 0; i < (size_t)width * height; ++i)
+    {
+        memmove(pixels + 3 * i, pixels + 4 * i, 3);
+    }
+
+    fopen_s(&file, path, "wb");
+    if (!file) goto ERROR_LABEL;
+
+    fprintf(file, "P6\n%d %d\n255\n", width, height);
+    size_t count = fwrite(pixels, 3, (size_t)width * height, file);
+    if (count != (size_t)width * height) goto ERROR_LABEL;
+
+    fclose(file);
+    free(pixels);
+
+    return EXIT_SUCCESS;
+
+ERROR_LABEL:
+    printf("ERROR - Renderer_SavePPM() %s\n", path);
+    assert(false);
+    if (file) fclose(file);
+    free(pixels);
+    return EXIT_FAILURE;
+}
+
+int Renderer_SavePNG(Renderer *renderer, const char *path)
+{
+    int width = renderer->m_width;
+    int height = renderer->m_height;
+    Uint8 *pixels = NULL;
+    SDL_Surface *surface = NULL;
+
+    pixels = (Uint8 *)malloc((size_t)width * height * 4);
+    if (!pixels) goto ERROR_LABEL;
+
+    Renderer_ReadPixels(renderer, pixels, width * 4);
+
+    // Octets R, G, B, A en mémoire
+    surface = SDL_CreateRGBSurfaceWithFormatFrom(
+        pixels, width, height, 32, width * 4, SDL_PIXELFORMAT_RGBA32);
+    if (!surface) goto ERROR_LABEL;
+
+    if (IMG_SavePNG(surface, path) < 0)
+    {
+        printf("IMG_SavePNG Error: %s\n", IMG_GetError());
+        goto ERROR_LABEL;
+    }
+
+    SDL_FreeSurface(surface);
+    free(pixels);
+
+    return EXIT_SUCCESS;
+
+ERROR_LABEL:
+    printf("ERROR - Renderer_SavePNG() %s\n", path);
+    assert(false);
+    if (surface) SDL_FreeSurface(surface);
+    free(pixels);
+    return EXIT_FAILURE;
+}
@@ -1,81 +1,1346 @@
-#pragma once
-
-#include "Settings.h"
-#include "Vector.h"
-
-typedef struct Renderer_s
-{
-    /// @protected
-    /// @brief Le moteur de rendu SDL.
-    SDL_Renderer *m_rendererSDL;
-
-    /// @protected
-    /// @brief La largeur en pixels de l'image rendue.
-    int m_width;
-
-    /// @protected
-    /// @brief La hauteur en pixels de l'image rendue.
-    int m_height;
-
-    /// @protected
-    /// @brief Le z-buffer (buffer de profondeur).
-    float **m_zBuffer;
-
-    /// @protected
-    /// @brief Texture en accs streaming dans laquelle copi le rendu.
-    SDL_Texture *m_streamTex;
-
-    /// @protected
-    /// @brief Tableau des pixels.
-    Uint32 *m_pixels;
-} Renderer;
-
-Renderer *Renderer_New(SDL_Renderer *rendererSDL);
-void Renderer_Free(Renderer *renderer);
-
-/// @ingroup Renderer
-/// @brief Renvoie la largeur du moteur de rendu.
-/// @param[in] renderer le moteur de rendu.
-/// @return La largeur du moteur de rendu.
-INLINE int Renderer_GetWidth(Renderer *renderer)
-{
-    return renderer->m_width;
-}
-
-/// @ingroup Renderer
-/// @brief Renvoie la hauteur du moteur de rendu.
-/// @param[in] renderer le moteur de rendu.
-/// @return La hauteur du moteur de rendu.
-INLINE int Renderer_GetHeight(Renderer *renderer)
-{
-    return renderer->m_height;
-}
-
-/// @ingroup Renderer
-/// @brief Dfinit la couleur d'un pixel sur le rendu.
-/// La position (x = 0, y = 0) dsigne le point en haut  gauche de l'cran.
-/// Le pixel n'est modifi que si sa profondeur est infrieure  la valeur associ
-/// dans le buffer de profondeur du moteur de rendu.
-/// @param[in,out] renderer le moteur de rendu.
-/// @param pixel position du pixel  dfinir.
-/// @param color la couleur du pixel.
-//void Renderer_SetPixelPre(Renderer *renderer, Pixel pixel, Vec4 color);
-void Renderer_SetPixel(Renderer *renderer, int x, int y, float zValue, Vec4 color, bool zWrite);
-
-void Renderer_DrawLine(Renderer *renderer, Vec3 p0, Vec3 p1, Vec4 color);
-
-/// @ingroup Renderer
-/// @brief Rinitialise le buffer de profondeur du moteur de rendu.
-/// @param[in,out] renderer le moteur de rendu.
-void Renderer_ResetDepthBuffer(Renderer *renderer);
-
-/// @ingroup Renderer
-/// @brief Remplit le rendu avec une couleur donne.
-/// @param[in,out] renderer le moteur de rendu.
-/// @param[in] color la couleur de remplissage.
-void Renderer_Fill(Renderer *renderer, Vec4 color);
-
-/// @ingroup Renderer
-/// @brief Met  jour la fentre avec le rendu calcul.
-/// @param[in,out] renderer le moteur de rendu.
-void Renderer_Update(Renderer *renderer);
+#pragma once
+
+#include "Settings.h"
+#include "Vector.h"
+#include "Raster.h"
+
+typedef struct TileBins_s TileBins;
+
+/// @brief Nombre de classes de l'histogramme des tailles de triangles.
+/// La classe 0 contient les triangles de moins d'un pixel, la classe i > 0
+/// ceux dont l'aire est dans [4^(i-1), 4^i[ pixels, la dernière classe
+/// contient tous les triangles plus grands.
+#define RENDERER_SIZE_BINS 8
+
+/// @brief Décalage de la profondeur des segments soumis au test de profondeur,
+/// qui évite que les arêtes d'un triangle soient masquées par le triangle lui-même.
+/// Il est appliqué à la profondeur convertie (voir Renderer_GetDepthValue()) :
+/// en reverse-Z, il augmente donc la coordonnée z normalisée.
+#define RENDERER_LINE_DEPTH_BIAS 1e-4f
+
+/// @brief Format du buffer de profondeur.
+/// Quel que soit le format, le pipeline de rastérisation manipule des profondeurs
+/// flottantes croissantes avec la distance (voir Renderer_GetDepthValue()) et le
+/// test de profondeur reste « inférieur ou égal ».
+typedef enum RendererDepthFormat_e
+{
+    /// @brief Flottants 32 bits, coordonnée z normalisée dans [-1, 1]
+    /// (projection standard).
+    RENDERER_DEPTH_FLOAT = 0,
+
+    /// @brief Entiers 16 bits normalisés (UNORM), coordonnée z normalisée dans
+    /// [-1, 1] ramenée à [0, 65535]. Divise par deux le trafic mémoire de la profondeur.
+    RENDERER_DEPTH_UNORM16,
+
+    /// @brief Flottants 32 bits en reverse-Z : coordonnée z normalisée dans [0, 1],
+    /// égale à 1 sur le plan near et à 0 sur le plan far (ou à l'infini).
+    /// Nécessite une projection inversée (voir Mat4_GetReversedProjectionMatrix()).
+    /// La profondeur est stockée négée, ce qui est exact et conserve la précision
+    /// des flottants proches de 0 pour les points éloignés.
+    RENDERER_DEPTH_FLOAT_REVERSED,
+
+    /// @brief Nombre de formats.
+    RENDERER_DEPTH_FORMAT_COUNT
+} RendererDepthFormat;
+
+/// @brief Rangement des pixels dans les buffers de couleur et de profondeur.
+/// Le buffer de profondeur et le buffer de couleur (ainsi que les buffers
+/// des échantillons en MSAA) ont toujours le même rangement.
+typedef enum RendererLayout_e
+{
+    /// @brief Ligne par ligne (axe y vers le bas), comme la texture SDL.
+    RENDERER_LAYOUT_LINEAR = 0,
+
+    /// @brief Par blocs de RASTER_BLOCK_SIZE x RASTER_BLOCK_SIZE pixels (repère
+    /// raster), les blocs et les pixels d'un bloc étant rangés ligne par ligne.
+    /// Un bloc du buffer de profondeur hiérarchique occupe une zone contiguë.
+    RENDERER_LAYOUT_TILED,
+
+    /// @brief Par blocs comme RENDERER_LAYOUT_TILED, les pixels d'un bloc étant
+    /// rangés selon l'ordre de Morton (courbe en Z) : chaque quad 2x2 et chaque
+    /// carré de 4x4 pixels occupent une zone contiguë.
+    RENDERER_LAYOUT_MORTON,
+
+    /// @brief Nombre de rangements.
+    RENDERER_LAYOUT_COUNT
+} RendererLayout;
+
+/// @brief Mode d'écriture des pixels lors de la rastérisation des triangles.
+typedef enum RendererWriteMode_e
+{
+    /// @brief Les triangles sont répartis dans les tuiles et chaque tuile est
+    /// rastérisée par un seul thread : un pixel n'a qu'un seul écrivain.
+    RENDERER_WRITE_TILED = 0,
+
+    /// @brief Les triangles sont rastérisés en parallèle (un thread par triangle).
+    /// La profondeur et la couleur d'un pixel sont regroupées dans un mot de 64 bits
+    /// mis à jour par compare-and-swap, sans verrou. Le mot conservé est le plus petit
+    /// (profondeur puis couleur) : le résultat ne dépend pas de l'ordre des écritures.
+    RENDERER_WRITE_ATOMIC,
+
+    /// @brief Comme RENDERER_WRITE_ATOMIC avec un seul thread : référence séquentielle
+    /// donnant le même résultat, sans contention.
+    RENDERER_WRITE_SERIAL,
+
+    /// @brief Nombre de modes.
+    RENDERER_WRITE_MODE_COUNT
+} RendererWriteMode;
+
+/// @brief Taux d'ombrage d'un bloc de RASTER_BLOCK_SIZE x RASTER_BLOCK_SIZE pixels :
+/// nombre de pixels colorés par une exécution du fragment shader.
+typedef enum RendererShadingRate_e
+{
+    /// @brief Une exécution par pixel.
+    RENDERER_SHADING_RATE_1X1 = 0,
+
+    /// @brief Une exécution par cellule de 2x2 pixels.
+    RENDERER_SHADING_RATE_2X2,
+
+    /// @brief Une exécution par cellule de 4x4 pixels.
+    RENDERER_SHADING_RATE_4X4,
+
+    /// @brief Nombre de taux.
+    RENDERER_SHADING_RATE_COUNT
+} RendererShadingRate;
+
+/// @brief Choix des taux d'ombrage des blocs de l'image (voir Renderer_SetShadingMode()).
+typedef enum RendererShadingMode_e
+{
+    /// @brief Le fragment shader est exécuté pour chaque pixel.
+    RENDERER_SHADING_FULL = 0,
+
+    /// @brief Le taux d'un bloc dépend du contraste de luminance du bloc
+    /// dans l'image précédente : les zones uniformes ou sombres sont ombrées
+    /// par cellules de 2x2 ou 4x4 pixels.
+    RENDERER_SHADING_CONTENT,
+
+    /// @brief Le taux d'un bloc dépend de sa distance au point fixé par
+    /// l'utilisateur (voir Renderer_SetFoveation()) : pleine résolution
+    /// dans le cercle, puis 2x2 jusqu'au double du rayon, 4x4 au-delà.
+    RENDERER_SHADING_FOVEATED,
+
+    /// @brief Nombre de modes.
+    RENDERER_SHADING_MODE_COUNT
+} RendererShadingMode;
+
+/// @brief Écart de luminance (sur 255) entre pixels voisins d'un bloc en dessous
+/// duquel le bloc est ombré par cellules de 2x2 pixels (voir RENDERER_SHADING_CONTENT).
+#define RENDERER_SHADING_CONTRAST_2X2 12
+
+/// @brief Écart de luminance (sur 255) entre pixels voisins d'un bloc en dessous
+/// duquel le bloc est ombré par cellules de 4x4 pixels (voir RENDERER_SHADING_CONTENT).
+#define RENDERER_SHADING_CONTRAST_4X4 4
+
+/// @brief Nombre d'entrées de la table de correction gamma (voir Renderer_SetToneMapping()).
+#define RENDERER_GAMMA_LUT_SIZE 16384
+
+/// @brief Nombre de framebuffers utilisés par la présentation asynchrone
+/// (double buffering, voir RENDERER_PRESENT_ASYNC).
+#define RENDERER_MAX_FRAMES 2
+
+/// @brief Facteur d'échelle minimal de la résolution interne
+/// (voir Renderer_SetResolutionScale()).
+#define RENDERER_MIN_RESOLUTION_SCALE 0.25f
+
+/// @brief Pixels sources et poids d'un pixel de l'image agrandie, selon un axe
+/// (interpolation bilinéaire, voir Renderer_SetResolutionScale()).
+typedef struct RendererUpscaleTap_s
+{
+    /// @brief Les coordonnées des deux pixels sources.
+    int p0, p1;
+
+    /// @brief Le poids du second pixel, entre 0 et 256.
+    Uint32 weight;
+} RendererUpscaleTap;
+
+/// @brief Mode de présentation des images rendues dans la fenêtre.
+typedef enum RendererPresentMode_e
+{
+    /// @brief Renderer_Update() copie l'image dans la texture et la présente
+    /// lui-même, attente de la synchronisation verticale comprise.
+    RENDERER_PRESENT_SYNC = 0,
+
+    /// @brief Un thread dédié calcule une image pendant que le thread principal
+    /// présente la précédente (voir Renderer_RenderFrame()).
+    /// Deux framebuffers suffisent : Renderer_RenderFrame() attend la fin du
+    /// calcul avant de rendre la main, une seule image est donc en attente de
+    /// présentation et aucune n'est abandonnée. Chaque image est affichée avec
+    /// une image de retard.
+    RENDERER_PRESENT_ASYNC,
+
+    /// @brief Nombre de modes.
+    RENDERER_PRESENT_MODE_COUNT
+} RendererPresentMode;
+
+/// @brief État d'un framebuffer de la présentation asynchrone.
+typedef enum RendererFrameState_e
+{
+    /// @brief Le framebuffer est libre.
+    RENDERER_FRAME_FREE = 0,
+
+    /// @brief Le framebuffer est rempli par Renderer_Update().
+    RENDERER_FRAME_WRITING,
+
+    /// @brief Le framebuffer contient une image en attente de présentation.
+    RENDERER_FRAME_QUEUED,
+
+    /// @brief Le framebuffer est en cours de présentation.
+    RENDERER_FRAME_PRESENTING,
+} RendererFrameState;
+
+/// @brief Statistiques de présentation cumulées depuis la création du moteur de rendu.
+typedef struct RendererPresentStats_s
+{
+    /// @brief Nombre d'images transmises par Renderer_Update().
+    long long framesRendered;
+
+    /// @brief Nombre d'images présentées dans la fenêtre.
+    long long framesPresented;
+
+    /// @brief Durée totale des présentations, en secondes : copie dans la
+    /// texture et attente de la synchronisation verticale.
+    double presentTime;
+
+    /// @brief Nombre d'appels à Renderer_RenderFrame() dont la présentation s'est
+    /// terminée avant le calcul de l'image : le thread appelant a attendu le thread
+    /// de rendu (RENDERER_PRESENT_ASYNC).
+    long long framesStalled;
+
+    /// @brief Durée totale de ces attentes, en secondes.
+    double stallTime;
+} RendererPresentStats;
+
+/// @brief Fonction calculant une image, exécutée par Renderer_RenderFrame().
+/// Elle se termine par l'appel à Renderer_Update().
+/// @param data les données transmises à Renderer_RenderFrame().
+typedef void RendererFrameFunc(void *data);
+
+/// @brief Effacements en attente d'une tuile (voir Renderer_PrepareTile()).
+typedef enum RendererClearFlag_e
+{
+    /// @brief Le buffer de profondeur (et le buffer hiérarchique) de la tuile
+    /// doit être réinitialisé.
+    RENDERER_CLEAR_DEPTH = 1 << 0,
+
+    /// @brief Les couleurs de la tuile doivent être remplies avec la couleur d'effacement.
+    RENDERER_CLEAR_COLOR = 1 << 1,
+} RendererClearFlag;
+
+/// @brief Statistiques de rastérisation accumulées pendant le rendu d'une image.
+typedef struct RendererStats_s
+{
+    /// @brief Nombre de blocs rejetés sans test par pixel (aucun pixel couvert).
+    long long blocksRejected;
+
+    /// @brief Nombre de blocs entièrement couverts, rastérisés sans test par pixel.
+    long long blocksAccepted;
+
+    /// @brief Nombre de blocs partiellement couverts, rastérisés avec un test par pixel.
+    long long blocksPartial;
+
+    /// @brief Nombre de pixels pour lesquels le fragment shader a été exécuté.
+    long long fragmentsShaded;
+
+    /// @brief Nombre d'exécutions du vertex shader.
+    long long verticesShaded;
+
+    /// @brief Nombre de sommets dont seule la projection a été recalculée
+    /// pour une vue supplémentaire (voir Graphics_RenderObjectViews()).
+    long long verticesProjected;
+
+    /// @brief Nombre de triangles rejetés car entièrement hors du frustum.
+    long long trianglesCulled;
+
+    /// @brief Nombre de triangles découpés par le plan near ou la bande de garde.
+    long long trianglesClipped;
+
+    /// @brief Nombre de pixels couverts rejetés par le test de profondeur
+    /// avant le fragment shader (early-Z).
+    long long fragmentsCulled;
+
+    /// @brief Nombre de triangles (comptés une fois par tuile) rejetés entièrement
+    /// par le buffer de profondeur hiérarchique.
+    long long trianglesOccluded;
+
+    /// @brief Nombre de blocs rejetés par le buffer de profondeur hiérarchique.
+    long long blocksOccluded;
+
+    /// @brief Nombre de pixels écrits par compare-and-swap (voir RENDERER_WRITE_ATOMIC).
+    long long atomicWrites;
+
+    /// @brief Nombre de compare-and-swap échoués car le pixel a été modifié
+    /// par un autre thread entre la lecture et l'écriture (contention).
+    long long atomicRetries;
+
+    /// @brief Nombre d'exécutions du fragment shader évitées par l'ombrage
+    /// à taux variable (pixels colorés par l'exécution d'un autre pixel).
+    long long shadingInvocationsSaved;
+
+    /// @brief Nombre de petits triangles rastérisés par un unique appel au noyau.
+    long long trianglesSmall;
+
+    /// @brief Nombre de petits triangles rejetés car ils ne couvrent aucun centre de pixel.
+    long long trianglesEmpty;
+
+    /// @brief Histogramme de l'aire à l'écran (en pixels) des triangles
+    /// vus de face (voir RENDERER_SIZE_BINS).
+    long long triangleSizes[RENDERER_SIZE_BINS];
+
+    /// @brief Espacement évitant que les statistiques de deux threads
+    /// partagent une même ligne de cache.
+    char padding[64];
+} RendererStats;
+
+typedef struct Renderer_s
+{
+    /// @protected
+    /// @brief Le moteur de rendu SDL.
+    SDL_Renderer *m_rendererSDL;
+
+    /// @protected
+    /// @brief La largeur en pixels de l'image rendue.
+    int m_width;
+
+    /// @protected
+    /// @brief La hauteur en pixels de l'image rendue.
+    int m_height;
+
+    /// @protected
+    /// @brief Le rectangle de l'image dans lequel les triangles sont projetés
+    /// et rastérisés (toute l'image par défaut, voir Renderer_SetViewport()).
+    SDL_Rect m_viewport;
+
+    /// @protected
+    /// @brief Facteur d'échelle de la résolution interne (1 en pleine résolution).
+    float m_resolutionScale;
+
+    /// @protected
+    /// @brief La largeur en pixels de l'image à la résolution interne.
+    int m_renderWidth;
+
+    /// @protected
+    /// @brief La hauteur en pixels de l'image à la résolution interne.
+    int m_renderHeight;
+
+    /// @protected
+    /// @brief Le rectangle de projection à la résolution interne, dans le coin
+    /// inférieur gauche des buffers (voir Renderer_GetRenderViewport()).
+    SDL_Rect m_renderViewport;
+
+    /// @protected
+    /// @brief Pixels sources de chaque colonne de l'image agrandie (m_width entrées).
+    /// Alloué au premier besoin.
+    RendererUpscaleTap *m_upscaleColumns;
+
+    /// @protected
+    /// @brief Durée cible du calcul d'une image en secondes, 0 si la résolution
+    /// dynamique est désactivée (voir Renderer_SetDynamicResolution()).
+    float m_targetFrameTime;
+
+    /// @protected
+    /// @brief Durée moyenne du calcul des dernières images en secondes.
+    float m_frameTime;
+
+    /// @protected
+    /// @brief Début du calcul de l'image courante (voir Renderer_BeginFrame()).
+    Uint64 m_frameStart;
+
+    /// @protected
+    /// @brief Le z-buffer (buffer de profondeur), de même rangement que m_pixels.
+    float *m_zBuffer;
+
+    /// @protected
+    /// @brief Le z-buffer au format RENDERER_DEPTH_UNORM16, alloué au premier
+    /// passage dans ce format.
+    Uint16 *m_zBuffer16;
+
+    /// @protected
+    /// @brief Format du buffer de profondeur (voir RendererDepthFormat).
+    RendererDepthFormat m_depthFormat;
+
+    /// @protected
+    /// @brief Rangement des pixels dans les buffers (voir RendererLayout).
+    RendererLayout m_layout;
+
+    /// @protected
+    /// @brief Mode d'écriture des pixels (voir RendererWriteMode).
+    RendererWriteMode m_writeMode;
+
+    /// @protected
+    /// @brief Profondeur (32 bits de poids fort, voir Renderer_GetDepthKey()) et
+    /// couleur (32 bits de poids faible) des pixels, de même rangement que m_pixels.
+    /// Utilisé entre Renderer_BeginPackedWrites() et Renderer_EndPackedWrites().
+    Uint64 *m_packedPixels;
+
+    /// @protected
+    /// @brief Indique si les écritures de pixels ont lieu dans m_packedPixels.
+    bool m_packedWrites;
+
+    /// @protected
+    /// @brief Nombre de pixels alloués pour chaque buffer, suffisant pour tous
+    /// les rangements (l'image est complétée en un nombre entier de blocs).
+    size_t m_bufferSize;
+
+    /// @protected
+    /// @brief Distance entre les plans de deux échantillons dans les buffers des
+    /// échantillons (voir Renderer_GetSampleIndex()).
+    size_t m_samplePlaneSize;
+
+    /// @protected
+    /// @brief Le buffer de profondeur hiérarchique.
+    /// Contient la profondeur maximale de chaque bloc de RASTER_BLOCK_SIZE x
+    /// RASTER_BLOCK_SIZE pixels du z-buffer (ligne par ligne, repère raster).
+    float *m_hiZ;
+
+    /// @protected
+    /// @brief Nombre de blocs du buffer de profondeur hiérarchique en largeur.
+    int m_hiZWidth;
+
+    /// @protected
+    /// @brief Nombre de blocs du buffer de profondeur hiérarchique en hauteur.
+    int m_hiZHeight;
+
+    /// @protected
+    /// @brief Choix des taux d'ombrage (voir RendererShadingMode).
+    RendererShadingMode m_shadingMode;
+
+    /// @protected
+    /// @brief Taux d'ombrage de chaque bloc (voir RendererShadingRate), sur la
+    /// grille du buffer de profondeur hiérarchique. Alloué au premier besoin.
+    Uint8 *m_shadingRates;
+
+    /// @protected
+    /// @brief Centre de la zone ombrée en pleine résolution, en coordonnées
+    /// normalisées de l'image ([0, 1], origine en haut à gauche).
+    Vec2 m_foveaCenter;
+
+    /// @protected
+    /// @brief Rayon de la zone ombrée en pleine résolution, relatif à la hauteur de l'image.
+    float m_foveaRadius;
+
+    /// @protected
+    /// @brief Nombre d'échantillons par pixel (1 ou RASTER_MSAA_SAMPLES).
+    int m_samples;
+
+    /// @protected
+    /// @brief Profondeurs des échantillons en MSAA, rangées échantillon par
+    /// échantillon : RASTER_MSAA_SAMPLES plans de m_bufferSize valeurs, chacun
+    /// dans le même ordre que m_pixels (voir Renderer_GetSampleIndex()).
+    float *m_sampleDepths;
+
+    /// @protected
+    /// @brief Profondeurs des échantillons au format RENDERER_DEPTH_UNORM16.
+    Uint16 *m_sampleDepths16;
+
+    /// @protected
+    /// @brief Couleurs des échantillons en MSAA (même rangement que m_sampleDepths).
+    /// Elles sont moyennées dans m_pixels par Renderer_Update().
+    Uint32 *m_sampleColors;
+
+    /// @protected
+    /// @brief Texture en accès streaming dans laquelle copié le rendu.
+    SDL_Texture *m_streamTex;
+
+    /// @protected
+    /// @brief Format des pixels de la texture, choisi parmi les formats 32 bits
+    /// natifs du moteur de rendu SDL (voir Renderer_PackColor()).
+    Uint32 m_pixelFormat;
+
+    /// @protected
+    /// @brief Décalages des composantes rouge, verte, bleue et alpha dans un
+    /// pixel au format m_pixelFormat.
+    int m_colorShifts[4];
+
+    /// @protected
+    /// @brief Tableau des pixels : m_pixelBuffer, ou la mémoire de la texture
+    /// verrouillée en rendu direct (voir Renderer_SetZeroCopy()).
+    Uint32 *m_pixels;
+
+    /// @protected
+    /// @brief Tableau des pixels alloué par le moteur de rendu.
+    Uint32 *m_pixelBuffer;
+
+    /// @protected
+    /// @brief Nombre de pixels séparant deux lignes en rangement linéaire,
+    /// égal au pitch de la texture (supérieur ou égal à la largeur).
+    /// Les buffers de profondeur utilisent le même pas que m_pixels.
+    int m_pitch;
+
+    /// @protected
+    /// @brief Indique si le rendu direct dans la texture est demandé.
+    bool m_zeroCopy;
+
+    /// @protected
+    /// @brief Indique si la texture est verrouillée (m_pixels pointe alors sur sa mémoire).
+    bool m_textureLocked;
+
+    /// @protected
+    /// @brief Framebuffers : images rangées ligne par ligne (axe y vers le bas)
+    /// copiées dans la texture. Le premier est utilisé en présentation synchrone
+    /// lorsque les buffers sont rangés par blocs. Alloués au premier besoin.
+    Uint32 *m_frames[RENDERER_MAX_FRAMES];
+
+    /// @protected
+    /// @brief État de chaque framebuffer en présentation asynchrone.
+    RendererFrameState m_frameStates[RENDERER_MAX_FRAMES];
+
+    /// @protected
+    /// @brief Mode de présentation (voir RendererPresentMode).
+    RendererPresentMode m_presentMode;
+
+    /// @protected
+    /// @brief Thread calculant les images pendant la présentation,
+    /// NULL en présentation synchrone.
+    /// Il n'appelle aucune fonction de rendu SDL : la texture et le moteur de
+    /// rendu SDL ne sont utilisés que par le thread ayant créé la fenêtre.
+    SDL_Thread *m_renderThread;
+
+    /// @protected
+    /// @brief Fonction et données de l'image confiée au thread de rendu.
+    RendererFrameFunc *m_renderFunc;
+    void *m_renderData;
+
+    /// @protected
+    /// @brief Indique qu'une image est confiée au thread de rendu et n'est pas terminée.
+    bool m_renderPending;
+
+    /// @protected
+    /// @brief Demande l'arrêt du thread de rendu.
+    bool m_renderQuit;
+
+    /// @protected
+    /// @brief Protège l'état des framebuffers, les statistiques de présentation
+    /// et l'état du thread de rendu.
+    SDL_mutex *m_presentMutex;
+
+    /// @protected
+    /// @brief Signalé à chaque changement d'état d'un framebuffer ou du thread de rendu.
+    SDL_cond *m_presentCond;
+
+    /// @protected
+    /// @brief Statistiques de présentation.
+    RendererPresentStats m_presentStats;
+
+    /// @protected
+    /// @brief Découpage de l'écran en tuiles utilisé pour la rastérisation parallèle.
+    TileBins *m_tileBins;
+
+    /// @protected
+    /// @brief Effacements en attente de chaque tuile de m_tileBins (bits de
+    /// RendererClearFlag). Une tuile en attente est logiquement remplie avec la
+    /// valeur d'effacement, sa mémoire n'est initialisée qu'à sa première écriture.
+    Uint8 *m_tileClearFlags;
+
+    /// @protected
+    /// @brief Couleur d'effacement définie par Renderer_Fill().
+    Uint32 m_clearColor;
+
+    /// @protected
+    /// @brief Couleur d'effacement définie par Renderer_Fill(), avant conversion.
+    Vec4 m_clearValue;
+
+    /// @protected
+    /// @brief Indique si les couleurs sont accumulées en flottants (HDR).
+    bool m_hdr;
+
+    /// @protected
+    /// @brief Couleurs HDR des pixels (même rangement que m_pixels).
+    /// Alloué au premier passage en HDR.
+    Vec4 *m_hdrPixels;
+
+    /// @protected
+    /// @brief Couleurs HDR des échantillons en MSAA (même rangement que m_sampleColors).
+    Vec4 *m_hdrSampleColors;
+
+    /// @protected
+    /// @brief Facteur d'exposition appliqué aux couleurs HDR avant le tone mapping.
+    float m_exposure;
+
+    /// @protected
+    /// @brief Table de correction gamma : valeur 8 bits d'une composante dans [0, 1]
+    /// obtenue après tone mapping, échantillonnée sur RENDERER_GAMMA_LUT_SIZE valeurs.
+    Uint8 m_gammaLut[RENDERER_GAMMA_LUT_SIZE];
+
+    /// @protected
+    /// @brief Indique si la rastérisation hiérarchique par blocs est utilisée.
+    bool m_hierarchical;
+
+    /// @protected
+    /// @brief Statistiques de rastérisation (une entrée par thread).
+    RendererStats *m_stats;
+
+    /// @protected
+    /// @brief Nombre d'entrées du tableau de statistiques.
+    int m_statsCount;
+} Renderer;
+
+Renderer *Renderer_New(SDL_Renderer *rendererSDL);
+
+/// @ingroup Renderer
+/// @brief Crée un moteur de rendu hors écran, sans fenêtre ni moteur de rendu SDL.
+/// Les images rendues restent dans les buffers du moteur de rendu et sont
+/// récupérées avec Renderer_ReadPixels(), Renderer_SavePPM() ou Renderer_SavePNG().
+/// Seule la présentation synchrone est disponible, sans rendu direct dans la texture.
+/// @param width la largeur en pixels de l'image rendue.
+/// @param height la hauteur en pixels de l'image rendue.
+/// @return Le moteur de rendu créé.
+Renderer *Renderer_NewOffscreen(int width, int height);
+
+void Renderer_Free(Renderer *renderer);
+
+/// @ingroup Renderer
+/// @brief Renvoie la largeur du moteur de rendu.
+/// @param[in] renderer le moteur de rendu.
+/// @return La largeur du moteur de rendu.
+INLINE int Renderer_GetWidth(Renderer *renderer)
+{
+    return renderer->m_width;
+}
+
+/// @ingroup Renderer
+/// @brief Renvoie la hauteur du moteur de rendu.
+/// @param[in] renderer le moteur de rendu.
+/// @return La hauteur du moteur de rendu.
+INLINE int Renderer_GetHeight(Renderer *renderer)
+{
+    return renderer->m_height;
+}
+
+/// @ingroup Renderer
+/// @brief Définit le rectangle de l'image dans lequel les triangles sont projetés
+/// (coordonnées normalisées [-1, 1] étendues au rectangle) et rastérisés.
+/// Les pixels hors du rectangle ne sont pas modifiés. L'effacement de l'image
+/// n'en dépend pas.
+/// @param[in,out] renderer le moteur de rendu.
+/// @param viewport le rectangle, contenu dans l'image (y vers le haut).
+void Renderer_SetViewport(Renderer *renderer, SDL_Rect viewport);
+
+/// @ingroup Renderer
+/// @brief Renvoie le rectangle de projection et de rastérisation du moteur de rendu
+/// (voir Renderer_SetViewport()).
+/// @param[in] renderer le moteur de rendu.
+/// @return Le rectangle de projection.
+INLINE SDL_Rect Renderer_GetViewport(Renderer *renderer)
+{
+    return renderer->m_viewport;
+}
+
+/// @ingroup Renderer
+/// @brief Renvoie le rectangle de projection à la résolution interne : le rectangle
+/// dans lequel les triangles sont effectivement rastérisés (voir
+/// Renderer_SetResolutionScale()). Égal à Renderer_GetViewport() en pleine résolution.
+/// @param[in] renderer le moteur de rendu.
+/// @return Le rectangle de projection à la résolution interne.
+INLINE SDL_Rect Renderer_GetRenderViewport(Renderer *renderer)
+{
+    return renderer->m_renderViewport;
+}
+
+/// @ingroup Renderer
+/// @brief Définit le facteur d'échelle de la résolution interne. L'image est rendue
+/// dans le coin inférieur gauche des buffers, aux dimensions de l'image multipliées
+/// par le facteur, puis agrandie par interpolation bilinéaire par Renderer_Update()
+/// (et Renderer_ReadPixels()). Les rectangles de projection (voir
+/// Renderer_SetViewport()) restent exprimés en pixels de l'image.
+/// Le changement doit avoir lieu entre deux images.
+/// @param[in,out] renderer le moteur de rendu.
+/// @param scale le facteur d'échelle, entre RENDERER_MIN_RESOLUTION_SCALE et 1.
+/// @return EXIT_SUCCESS ou EXIT_FAILURE.
+int Renderer_SetResolutionScale(Renderer *renderer, float scale);
+
+/// @ingroup Renderer
+/// @brief Renvoie le facteur d'échelle de la résolution interne.
+/// @param[in] renderer le moteur de rendu.
+/// @return Le facteur d'échelle.
+INLINE float Renderer_GetResolutionScale(Renderer *renderer)
+{
+    return renderer->m_resolutionScale;
+}
+
+/// @ingroup Renderer
+/// @brief Active la résolution dynamique : au début de chaque image (voir
+/// Renderer_BeginFrame()), le facteur d'échelle de la résolution interne est
+/// choisi à partir de la durée du calcul des dernières images, mesurée de
+/// Renderer_BeginFrame() à Renderer_Update(), pour respecter une durée cible.
+/// @param[in,out] renderer le moteur de rendu.
+/// @param targetFrameTime la durée cible en secondes, 0 pour désactiver la
+/// résolution dynamique (la pleine résolution est alors rétablie).
+/// @return EXIT_SUCCESS ou EXIT_FAILURE.
+int Renderer_SetDynamicResolution(Renderer *renderer, float targetFrameTime);
+
+/// @ingroup Renderer
+/// @brief Renvoie la durée cible de la résolution dynamique en secondes,
+/// 0 si elle est désactivée.
+/// @param[in] renderer le moteur de rendu.
+INLINE float Renderer_GetTargetFrameTime(Renderer *renderer)
+{
+    return renderer->m_targetFrameTime;
+}
+
+/// @ingroup Renderer
+/// @brief Renvoie la durée moyenne du calcul des dernières images en secondes,
+/// de Renderer_BeginFrame() à Renderer_Update() (présentation exclue).
+/// @param[in] renderer le moteur de rendu.
+INLINE float Renderer_GetFrameTime(Renderer *renderer)
+{
+    return renderer->m_frameTime;
+}
+
+/// @ingroup Renderer
+/// @brief Renvoie le découpage en tuiles du moteur de rendu.
+/// @param[in] renderer le moteur de rendu.
+/// @return Les tuiles du moteur de rendu.
+INLINE TileBins *Renderer_GetTileBins(Renderer *renderer)
+{
+    return renderer->m_tileBins;
+}
+
+/// @ingroup Renderer
+/// @brief Définit si le moteur de rendu utilise la rastérisation hiérarchique.
+/// Les triangles sont alors parcourus par blocs de RASTER_BLOCK_SIZE pixels :
+/// les blocs hors du triangle sont ignorés et les blocs entièrement couverts
+/// sont rastérisés sans test par pixel.
+/// @param[in,out] renderer le moteur de rendu.
+/// @param hierarchical booléen indiquant si la rastérisation hiérarchique est utilisée.
+INLINE void Renderer_SetHierarchical(Renderer *renderer, bool hierarchical)
+{
+    renderer->m_hierarchical = hierarchical;
+}
+
+/// @ingroup Renderer
+/// @brief Renvoie un booléen indiquant si la rastérisation hiérarchique est utilisée.
+/// @param[in] renderer le moteur de rendu.
+/// @return Un booléen indiquant si la rastérisation hiérarchique est utilisée.
+INLINE bool Renderer_GetHierarchical(Renderer *renderer)
+{
+    return renderer->m_hierarchical;
+}
+
+/// @ingroup Renderer
+/// @brief Définit le nombre d'échantillons par pixel du moteur de rendu.
+/// Avec RASTER_MSAA_SAMPLES échantillons (MSAA), la couverture et la profondeur
+/// sont calculées pour chaque échantillon mais le fragment shader n'est exécuté
+/// qu'une fois par pixel et par triangle. Les buffers des échantillons sont
+/// alloués au premier passage en MSAA.
+/// Comme sans MSAA, les échantillons d'une tuile ne sont effacés qu'au rendu de
+/// son premier triangle et le resolve ne lit que les tuiles rendues : les tuiles
+/// vides reçoivent directement la couleur d'effacement (voir Renderer_PrepareTile()).
+/// Les échantillons sont rangés dans un plan par échantillon et la couverture
+/// n'est évaluée que pour les échantillons partiellement couverts d'un bloc.
+/// Coût mesuré : le test de profondeur et l'écriture restant effectués pour chaque
+/// échantillon, une image coûte de 1,6 à 2 fois une image sans MSAA sur les modèles
+/// fournis (1280 x 720, un thread) ; l'objectif initial de 1,3 fois n'est pas atteint.
+/// @param[in,out] renderer le moteur de rendu.
+/// @param samples le nombre d'échantillons (1 ou RASTER_MSAA_SAMPLES).
+/// @return EXIT_SUCCESS ou EXIT_FAILURE.
+int Renderer_SetSampleCount(Renderer *renderer, int samples);
+
+/// @ingroup Renderer
+/// @brief Renvoie le nombre d'échantillons par pixel du moteur de rendu.
+/// @param[in] renderer le moteur de rendu.
+/// @return Le nombre d'échantillons par pixel.
+INLINE int Renderer_GetSampleCount(Renderer *renderer)
+{
+    return renderer->m_samples;
+}
+
+/// @ingroup Renderer
+/// @brief Définit le format du buffer de profondeur du moteur de rendu.
+/// La projection de la caméra doit correspondre au format : inversée pour
+/// RENDERER_DEPTH_FLOAT_REVERSED, standard sinon (voir Scene_SetDepthFormat()).
+/// @param[in,out] renderer le moteur de rendu.
+/// @param format le format du buffer de profondeur.
+/// @return EXIT_SUCCESS ou EXIT_FAILURE.
+int Renderer_SetDepthFormat(Renderer *renderer, RendererDepthFormat format);
+
+/// @ingroup Renderer
+/// @brief Définit si les couleurs sont accumulées en flottants (HDR).
+/// Les fragments sont alors écrits sans conversion, y compris au-delà de 1.
+/// Renderer_Update() applique une seule fois par pixel l'exposition, le tone
+/// mapping (Reinhard), la correction gamma et la conversion au format de la
+/// texture (voir Renderer_SetToneMapping()). Les buffers HDR sont alloués
+/// au premier passage en HDR.
+/// @param[in,out] renderer le moteur de rendu.
+/// @param hdr true pour accumuler les couleurs en flottants.
+/// @return EXIT_SUCCESS ou EXIT_FAILURE.
+int Renderer_SetHdr(Renderer *renderer, bool hdr);
+
+/// @ingroup Renderer
+/// @brief Renvoie un booléen indiquant si les couleurs sont accumulées en flottants.
+/// @param[in] renderer le moteur de rendu.
+/// @return true si les couleurs sont accumulées en flottants.
+INLINE bool Renderer_GetHdr(Renderer *renderer)
+{
+    return renderer->m_hdr;
+}
+
+/// @ingroup Renderer
+/// @brief Définit les paramètres de la conversion des couleurs HDR.
+/// Chaque composante c est convertie en (e c) / (1 + e c), où e est l'exposition,
+/// puis élevée à la puissance 1 / gamma au moyen d'une table.
+/// @param[in,out] renderer le moteur de rendu.
+/// @param exposure le facteur d'exposition.
+/// @param gamma le gamma de l'écran (2.2 par défaut, 1 pour aucune correction).
+void Renderer_SetToneMapping(Renderer *renderer, float exposure, float gamma);
+
+/// @ingroup Renderer
+/// @brief Renvoie le format du buffer de profondeur du moteur de rendu.
+/// @param[in] renderer le moteur de rendu.
+/// @return Le format du buffer de profondeur.
+INLINE RendererDepthFormat Renderer_GetDepthFormat(Renderer *renderer)
+{
+    return renderer->m_depthFormat;
+}
+
+/// @ingroup Renderer
+/// @brief Convertit la coordonnée z normalisée d'un point (après la division
+/// par w) en la profondeur utilisée par le pipeline de rastérisation, croissante
+/// avec la distance quel que soit le format (voir RendererDepthFormat).
+/// @param[in] renderer le moteur de rendu.
+/// @param z la coordonnée z normalisée.
+/// @return La profondeur du point.
+INLINE float Renderer_GetDepthValue(Renderer *renderer, float z)
+{
+    switch (renderer->m_depthFormat)
+    {
+    case RENDERER_DEPTH_UNORM16:        return 0.5f * z + 0.5f;
+    case RENDERER_DEPTH_FLOAT_REVERSED: return -z;
+    default:                            return z;
+    }
+}
+
+/// @ingroup Renderer
+/// @brief Convertit une profondeur dans [0, 1] au format RENDERER_DEPTH_UNORM16.
+INLINE Uint16 Renderer_EncodeDepth16(float depth)
+{
+    return (Uint16)lrintf(fminf(fmaxf(depth, 0.0f), 1.0f) * 65535.0f);
+}
+
+/// @ingroup Renderer
+/// @brief Convertit une profondeur au format RENDERER_DEPTH_UNORM16 en flottant.
+/// La borne supérieure de l'intervalle arrondi à la valeur est renvoyée : une
+/// profondeur flottante lui est inférieure ou égale si et seulement si sa valeur
+/// arrondie l'est aussi, les tests anticipés (early-Z, Hi-Z) sont donc exacts.
+INLINE float Renderer_DecodeDepth16(Uint16 value)
+{
+    return ((float)value + 0.5f) * (1.0f / 65535.0f);
+}
+
+/// @ingroup Renderer
+/// @brief Définit le mode d'écriture des pixels lors de la rastérisation des triangles
+/// (voir RendererWriteMode). Les modes RENDERER_WRITE_ATOMIC et RENDERER_WRITE_SERIAL
+/// ne sont disponibles qu'avec un échantillon par pixel et sans HDR ; le test de
+/// profondeur y est toujours effectué après le fragment shader.
+/// @param[in,out] renderer le moteur de rendu.
+/// @param mode le mode d'écriture.
+/// @return EXIT_SUCCESS ou EXIT_FAILURE.
+int Renderer_SetWriteMode(Renderer *renderer, RendererWriteMode mode);
+
+/// @ingroup Renderer
+/// @brief Renvoie le mode d'écriture des pixels du moteur de rendu.
+/// @param[in] renderer le moteur de rendu.
+/// @return Le mode d'écriture.
+INLINE RendererWriteMode Renderer_GetWriteMode(Renderer *renderer)
+{
+    return renderer->m_writeMode;
+}
+
+/// @ingroup Renderer
+/// @brief Convertit une profondeur en un entier de même ordre, selon le format
+/// du buffer de profondeur : profondeur arrondie en RENDERER_DEPTH_UNORM16, bits
+/// du flottant réordonnés sinon (conversion exacte et réversible).
+/// @param[in] renderer le moteur de rendu.
+/// @param zValue la profondeur (voir Renderer_GetDepthValue()).
+/// @return La clé de la profondeur.
+INLINE Uint32 Renderer_GetDepthKey(Renderer *renderer, float zValue)
+{
+    if (renderer->m_depthFormat == RENDERER_DEPTH_UNORM16)
+    {
+        return Renderer_EncodeDepth16(zValue);
+    }
+
+    Uint32 bits;
+    memcpy(&bits, &zValue, sizeof(bits));
+    return (bits & 0x80000000u) ? ~bits : (bits | 0x80000000u);
+}
+
+/// @ingroup Renderer
+/// @brief Commence l'écriture des pixels regroupés (profondeur et couleur) du
+/// rectangle de projection : les effacements en attente sont effectués, puis
+/// les pixels sont copiés dans m_packedPixels. Jusqu'à Renderer_EndPackedWrites(),
+/// Renderer_SetPixel() met à jour les pixels regroupés par compare-and-swap et
+/// peut être appelée par plusieurs threads pour un même pixel.
+/// @param[in,out] renderer le moteur de rendu.
+void Renderer_BeginPackedWrites(Renderer *renderer);
+
+/// @ingroup Renderer
+/// @brief Termine l'écriture des pixels regroupés : la profondeur et la couleur
+/// des pixels du rectangle de projection sont recopiées dans leurs buffers et le
+/// buffer de profondeur hiérarchique est recalculé.
+/// @param[in,out] renderer le moteur de rendu.
+void Renderer_EndPackedWrites(Renderer *renderer);
+
+/// @ingroup Renderer
+/// @brief Indique si les écritures de pixels ont lieu dans les pixels regroupés
+/// (entre Renderer_BeginPackedWrites() et Renderer_EndPackedWrites()).
+/// @param[in] renderer le moteur de rendu.
+INLINE bool Renderer_GetPackedWrites(Renderer *renderer)
+{
+    return renderer->m_packedWrites;
+}
+
+/// @ingroup Renderer
+/// @brief Définit le choix des taux d'ombrage des blocs de l'image (ombrage à taux
+/// variable, voir RendererShadingMode). Avec un taux 2x2 ou 4x4, le fragment shader
+/// est exécuté au premier pixel visible de chaque cellule et sa couleur est donnée
+/// aux autres pixels visibles de la cellule ; la profondeur reste calculée et testée
+/// pour chaque pixel. Les taux sont ignorés en MSAA.
+/// @param[in,out] renderer le moteur de rendu.
+/// @param mode le choix des taux.
+/// @return EXIT_SUCCESS ou EXIT_FAILURE.
+int Renderer_SetShadingMode(Renderer *renderer, RendererShadingMode mode);
+
+/// @ingroup Renderer
+/// @brief Renvoie le choix des taux d'ombrage du moteur de rendu.
+/// @param[in] renderer le moteur de rendu.
+/// @return Le choix des taux d'ombrage.
+INLINE RendererShadingMode Renderer_GetShadingMode(Renderer *renderer)
+{
+    return renderer->m_shadingMode;
+}
+
+/// @ingroup Renderer
+/// @brief Définit la zone ombrée en pleine résolution par RENDERER_SHADING_FOVEATED.
+/// @param[in,out] renderer le moteur de rendu.
+/// @param center le centre de la zone en coordonnées normalisées de l'image
+/// ([0, 1], origine en haut à gauche).
+/// @param radius le rayon de la zone, relatif à la hauteur de l'image.
+void Renderer_SetFoveation(Renderer *renderer, Vec2 center, float radius);
+
+/// @ingroup Renderer
+/// @brief Renvoie le taux d'ombrage du bloc contenant un pixel.
+/// @param[in] renderer le moteur de rendu.
+/// @param x, y les coordonnées du pixel (repère raster).
+/// @return Le taux d'ombrage, RENDERER_SHADING_RATE_1X1 sans ombrage à taux variable.
+INLINE RendererShadingRate Renderer_GetShadingRate(Renderer *renderer, int x, int y)
+{
+    if (renderer->m_shadingMode == RENDERER_SHADING_FULL)
+        return RENDERER_SHADING_RATE_1X1;
+
+    return (RendererShadingRate)renderer->m_shadingRates[
+        (y / RASTER_BLOCK_SIZE) * renderer->m_hiZWidth + x / RASTER_BLOCK_SIZE];
+}
+
+/// @ingroup Renderer
+/// @brief Définit le rangement des pixels dans les buffers du moteur de rendu.
+/// Le contenu des buffers n'est pas conservé : le changement doit avoir lieu
+/// entre deux images.
+/// @param[in,out] renderer le moteur de rendu.
+/// @param layout le rangement des pixels.
+/// @return EXIT_SUCCESS ou EXIT_FAILURE.
+int Renderer_SetLayout(Renderer *renderer, RendererLayout layout);
+
+/// @ingroup Renderer
+/// @brief Renvoie le rangement des pixels dans les buffers du moteur de rendu.
+/// @param[in] renderer le moteur de rendu.
+/// @return Le rangement des pixels.
+INLINE RendererLayout Renderer_GetLayout(Renderer *renderer)
+{
+    return renderer->m_layout;
+}
+
+/// @ingroup Renderer
+/// @brief Intercale des bits nuls entre les bits d'un entier de 3 bits
+/// (b2 b1 b0 devient b2 0 b1 0 b0).
+INLINE int Renderer_SpreadBits(int value)
+{
+    return (value & 1) | ((value & 2) << 1) | ((value & 4) << 2);
+}
+
+/// @ingroup Renderer
+/// @brief Renvoie l'indice d'un pixel dans les buffers du moteur de rendu
+/// (voir RendererLayout). En MSAA, l'indice d'un échantillon du pixel est
+/// donné par Renderer_GetSampleIndex().
+/// Le pixel est désigné dans le même repère que pour Renderer_SetPixel().
+/// @param[in] renderer le moteur de rendu.
+/// @param x l'abscisse du pixel.
+/// @param y l'ordonnée du pixel.
+/// @return L'indice du pixel.
+INLINE size_t Renderer_GetIndex(Renderer *renderer, int x, int y)
+{
+    if (renderer->m_layout == RENDERER_LAYOUT_LINEAR)
+    {
+        return (size_t)(renderer->m_height - 1 - y) * renderer->m_pitch + x;
+    }
+
+    // Les coordonnées sont positives : les divisions sont des décalages
+    // (RASTER_BLOCK_SIZE = 8)
+    unsigned ux = (unsigned)x, uy = (unsigned)y;
+    size_t block = (size_t)(uy / RASTER_BLOCK_SIZE) * renderer->m_hiZWidth + ux / RASTER_BLOCK_SIZE;
+    int bx = (int)(ux % RASTER_BLOCK_SIZE);
+    int by = (int)(uy % RASTER_BLOCK_SIZE);
+    int offset = (renderer->m_layout == RENDERER_LAYOUT_TILED) ?
+        by * RASTER_BLOCK_SIZE + bx :
+        Renderer_SpreadBits(bx) | (Renderer_SpreadBits(by) << 1);
+
+    return block * (RASTER_BLOCK_SIZE * RASTER_BLOCK_SIZE) + offset;
+}
+
+/// @ingroup Renderer
+/// @brief Renvoie l'indice d'un échantillon dans les buffers des échantillons (MSAA).
+/// Chaque échantillon occupe un plan de m_bufferSize valeurs, rangé comme les pixels :
+/// les profondeurs d'un même échantillon de pixels voisins sont contiguës.
+/// @param[in] renderer le moteur de rendu.
+/// @param index l'indice du pixel (voir Renderer_GetIndex()).
+/// @param sample l'indice de l'échantillon.
+/// @return L'indice de l'échantillon.
+INLINE size_t Renderer_GetSampleIndex(Renderer *renderer, size_t index, int sample)
+{
+    return (size_t)sample * renderer->m_samplePlaneSize + index;
+}
+
+/// @ingroup Renderer
+/// @brief Renvoie les statistiques de rastérisation du thread courant.
+/// Chaque thread accumule ses statistiques séparément, sans synchronisation.
+/// @param[in] renderer le moteur de rendu.
+/// @return Les statistiques du thread courant.
+INLINE RendererStats *Renderer_GetThreadStats(Renderer *renderer)
+{
+    int thread = omp_get_thread_num();
+    assert(thread < renderer->m_statsCount);
+    return renderer->m_stats + thread;
+}
+
+/// @ingroup Renderer
+/// @brief Renvoie la classe de l'histogramme des tailles de triangles
+/// correspondant à une aire.
+/// @param pixelArea l'aire du triangle en pixels.
+/// @return La classe de l'aire, entre 0 et RENDERER_SIZE_BINS - 1.
+INLINE int Renderer_GetSizeBin(float pixelArea)
+{
+    int bin = 0;
+    for (float size = 1.0f; pixelArea >= size && bin < RENDERER_SIZE_BINS - 1; size *= 4.0f)
+    {
+        bin++;
+    }
+    return bin;
+}
+
+/// @ingroup Renderer
+/// @brief Remet à zéro les statistiques de rastérisation.
+/// @param[in,out] renderer le moteur de rendu.
+void Renderer_ResetStats(Renderer *renderer);
+
+/// @ingroup Renderer
+/// @brief Renvoie les statistiques de rastérisation cumulées de tous les threads
+/// depuis le dernier appel à Renderer_ResetStats().
+/// @param[in] renderer le moteur de rendu.
+/// @return Les statistiques cumulées.
+RendererStats Renderer_GetStats(Renderer *renderer);
+
+/// @ingroup Renderer
+/// @brief Définit la couleur d'un pixel sur le rendu.
+/// La position (x = 0, y = 0) désigne le point en haut à gauche de l'écran.
+/// Le pixel n'est modifié que si sa profondeur est inférieure à la valeur associé
+/// dans le buffer de profondeur du moteur de rendu.
+/// La tuile contenant le pixel doit avoir été préparée (voir Renderer_PrepareTile()).
+/// @param[in,out] renderer le moteur de rendu.
+/// @param pixel position du pixel à définir.
+/// @param color la couleur du pixel.
+//void Renderer_SetPixelPre(Renderer *renderer, Pixel pixel, Vec4 color);
+void Renderer_SetPixel(Renderer *renderer, int x, int y, float zValue, Vec4 color, bool zWrite);
+
+/// @ingroup Renderer
+/// @brief Définit la couleur de certains échantillons d'un pixel en MSAA.
+/// Chaque échantillon n'est modifié que s'il passe le test de profondeur.
+/// Le pixel est désigné dans le même repère que pour Renderer_SetPixel().
+/// @param[in,out] renderer le moteur de rendu.
+/// @param x l'abscisse du pixel.
+/// @param y l'ordonnée du pixel.
+/// @param sampleMask le masque des échantillons à modifier (bit s pour l'échantillon s).
+/// @param[in] zValues les profondeurs des RASTER_MSAA_SAMPLES échantillons.
+/// @param color la couleur du pixel.
+/// @param zWrite true si le buffer de profondeur doit être mis à jour.
+void Renderer_SetSamples(
+    Renderer *renderer, int x, int y, unsigned sampleMask,
+    const float *zValues, Vec4 color, bool zWrite);
+
+/// @ingroup Renderer
+/// @brief Dessine un segment sur le rendu.
+/// Le segment est découpé par le rectangle de projection (voir Renderer_SetViewport())
+/// avant d'être parcouru.
+/// Les effacements en attente sont effectués au préalable (voir Renderer_PrepareAllTiles()).
+/// @param[in,out] renderer le moteur de rendu.
+/// @param p0, p1 les extrémités du segment en coordonnées normalisées (clip space
+/// après la division par w), z contient la profondeur.
+/// @param color la couleur du segment.
+/// @param depthTest true si les pixels du segment sont soumis au test de profondeur
+/// (sans modifier le buffer de profondeur), false pour un segment toujours visible.
+void Renderer_DrawLine(Renderer *renderer, Vec3 p0, Vec3 p1, Vec4 color, bool depthTest);
+
+/// @ingroup Renderer
+/// @brief Dessine la partie d'un segment contenue dans un rectangle de l'écran
+/// (bornes incluses, voir Renderer_DrawLine()). Les tuiles du rectangle doivent
+/// avoir été préparées (voir Renderer_PrepareTile()).
+/// Les pixels d'un segment ne dépendent pas du rectangle : un segment peut être
+/// dessiné tuile par tuile, par des threads différents.
+/// @param[in,out] renderer le moteur de rendu.
+/// @param p0, p1 les extrémités du segment en coordonnées normalisées.
+/// @param color la couleur du segment.
+/// @param depthTest true si les pixels du segment sont soumis au test de profondeur.
+/// @param xmin, ymin, xmax, ymax le rectangle de l'écran.
+void Renderer_DrawLineRect(
+    Renderer *renderer, Vec3 p0, Vec3 p1, Vec4 color, bool depthTest,
+    int xmin, int ymin, int xmax, int ymax);
+
+/// @ingroup Renderer
+/// @brief Renvoie la valeur du buffer de profondeur associée à un pixel.
+/// Le pixel est désigné dans le même repère que pour Renderer_SetPixel().
+/// @param[in] renderer le moteur de rendu.
+/// @param x l'abscisse du pixel.
+/// @param y l'ordonnée du pixel.
+/// @return La profondeur enregistrée pour le pixel.
+INLINE float Renderer_GetDepth(Renderer *renderer, int x, int y)
+{
+    size_t index = Renderer_GetIndex(renderer, x, y);
+    if (renderer->m_depthFormat == RENDERER_DEPTH_UNORM16)
+    {
+        return Renderer_DecodeDepth16(renderer->m_zBuffer16[index]);
+    }
+    return renderer->m_zBuffer[index];
+}
+
+/// @ingroup Renderer
+/// @brief Calcule les indices des pixels d'un groupe (voir RASTER_LANE_X()) dans
+/// les buffers du moteur de rendu (voir Renderer_GetIndex()).
+/// Les pixels hors du masque, qui peuvent être hors de l'image, reçoivent
+/// l'indice du premier pixel du masque : leur lecture reste valide.
+/// @param[in] renderer le moteur de rendu.
+/// @param gx, gy la position du premier pixel du groupe.
+/// @param laneMask le masque des pixels du groupe.
+/// @param[out] indices les RASTER_LANES indices des pixels.
+INLINE void Renderer_GetGroupIndices(
+    Renderer *renderer, int gx, int gy, unsigned laneMask, size_t *indices)
+{
+    size_t first = 0;
+    for (int k = RASTER_LANES - 1; k >= 0; --k)
+    {
+        if (laneMask & (1u << k))
+        {
+            first = Renderer_GetIndex(renderer, gx + RASTER_LANE_X(k), gy + RASTER_LANE_Y(k));
+            indices[k] = first;
+        }
+    }
+    for (int k = 0; k < RASTER_LANES; ++k)
+    {
+        if ((laneMask & (1u << k)) == 0)
+        {
+            indices[k] = first;
+        }
+    }
+}
+
+/// @ingroup Renderer
+/// @brief Renvoie les profondeurs d'un échantillon des pixels d'un groupe en MSAA,
+/// lues directement dans le plan de l'échantillon (voir Renderer_GetSampleIndex()).
+/// @param[in] renderer le moteur de rendu.
+/// @param[in] indices les indices des pixels (voir Renderer_GetGroupIndices()).
+/// @param sample l'indice de l'échantillon.
+/// @param[out] depths les RASTER_LANES profondeurs de l'échantillon.
+INLINE void Renderer_GetGroupSampleDepths(
+    Renderer *renderer, const size_t *indices, int sample, float *depths)
+{
+    size_t plane = Renderer_GetSampleIndex(renderer, 0, sample);
+    if (renderer->m_depthFormat == RENDERER_DEPTH_UNORM16)
+    {
+        const Uint16 *depths16 = renderer->m_sampleDepths16 + plane;
+        for (int k = 0; k < RASTER_LANES; ++k)
+        {
+            depths[k] = Renderer_DecodeDepth16(depths16[indices[k]]);
+        }
+        return;
+    }
+
+    const float *planeDepths = renderer->m_sampleDepths + plane;
+    for (int k = 0; k < RASTER_LANES; ++k)
+    {
+        depths[k] = planeDepths[indices[k]];
+    }
+}
+
+/// @ingroup Renderer
+/// @brief Renvoie la profondeur maximale d'un bloc du z-buffer.
+/// Un fragment plus profond que cette valeur est caché quel que soit son pixel dans le bloc.
+/// @param[in] renderer le moteur de rendu.
+/// @param bx l'indice horizontal du bloc (x / RASTER_BLOCK_SIZE).
+/// @param by l'indice vertical du bloc (y / RASTER_BLOCK_SIZE).
+/// @return La profondeur maximale du bloc.
+INLINE float Renderer_GetHiZ(Renderer *renderer, int bx, int by)
+{
+    return renderer->m_hiZ[by * renderer->m_hiZWidth + bx];
+}
+
+/// @ingroup Renderer
+/// @brief Définit la profondeur maximale d'un bloc, déjà connue de l'appelant
+/// (voir Renderer_UpdateHiZ()). La valeur doit être au moins égale à la profondeur
+/// de chaque pixel, ou de chaque échantillon en MSAA, du bloc.
+/// @param[in,out] renderer le moteur de rendu.
+/// @param bx l'indice horizontal du bloc (x / RASTER_BLOCK_SIZE).
+/// @param by l'indice vertical du bloc (y / RASTER_BLOCK_SIZE).
+/// @param zmax la profondeur maximale du bloc.
+INLINE void Renderer_SetHiZ(Renderer *renderer, int bx, int by, float zmax)
+{
+    renderer->m_hiZ[by * renderer->m_hiZWidth + bx] = zmax;
+}
+
+/// @ingroup Renderer
+/// @brief Recalcule la profondeur maximale d'un bloc à partir du z-buffer.
+/// Doit être appelée après l'écriture de pixels du bloc, par le thread propriétaire
+/// de la tuile contenant le bloc.
+/// @param[in,out] renderer le moteur de rendu.
+/// @param bx l'indice horizontal du bloc (x / RASTER_BLOCK_SIZE).
+/// @param by l'indice vertical du bloc (y / RASTER_BLOCK_SIZE).
+void Renderer_UpdateHiZ(Renderer *renderer, int bx, int by);
+
+/// @ingroup Renderer
+/// @brief Réinitialise le buffer de profondeur du moteur de rendu.
+/// L'effacement est différé : les tuiles sont seulement marquées et chacune est
+/// réinitialisée à sa première écriture (voir Renderer_PrepareTile()).
+/// Le buffer de profondeur d'une tuile sans écriture n'est jamais parcouru.
+/// @param[in,out] renderer le moteur de rendu.
+void Renderer_ResetDepthBuffer(Renderer *renderer);
+
+/// @ingroup Renderer
+/// @brief Remplit le rendu avec une couleur donnée.
+/// Le remplissage est différé comme pour Renderer_ResetDepthBuffer() : les tuiles
+/// sans écriture sont remplies lors de Renderer_Update().
+/// @param[in,out] renderer le moteur de rendu.
+/// @param[in] color la couleur de remplissage.
+void Renderer_Fill(Renderer *renderer, Vec4 color);
+
+/// @ingroup Renderer
+/// @brief Commence le rendu d'une nouvelle image.
+/// En résolution dynamique, choisit le facteur d'échelle de la résolution interne
+/// (voir Renderer_SetDynamicResolution()) et, en ombrage fovéal, les taux d'ombrage
+/// des blocs (voir Renderer_SetShadingMode()). En rendu direct dans la texture et en
+/// pleine résolution, verrouille la texture : les pixels sont ensuite écrits dans
+/// sa mémoire jusqu'à Renderer_Update().
+/// @param[in,out] renderer le moteur de rendu.
+void Renderer_BeginFrame(Renderer *renderer);
+
+/// @ingroup Renderer
+/// @brief Effectue les effacements en attente d'une tuile de Renderer_GetTileBins().
+/// Doit être appelée avant toute lecture ou écriture des pixels de la tuile,
+/// par le thread propriétaire de la tuile.
+/// @param[in,out] renderer le moteur de rendu.
+/// @param tileIndex l'indice de la tuile.
+void Renderer_PrepareTile(Renderer *renderer, int tileIndex);
+
+/// @ingroup Renderer
+/// @brief Effectue les effacements en attente de toutes les tuiles.
+/// Permet d'écrire des pixels hors de la rastérisation par tuiles
+/// (Renderer_SetPixel() par exemple).
+/// @param[in,out] renderer le moteur de rendu.
+void Renderer_PrepareAllTiles(Renderer *renderer);
+
+/// @ingroup Renderer
+/// @brief Met à jour la fenêtre avec le rendu calculé.
+/// En MSAA, la couleur de chaque pixel est d'abord obtenue en moyennant
+/// celles de ses échantillons (resolve). En HDR, les couleurs sont ensuite
+/// converties (voir Renderer_SetHdr()). En ombrage selon le contenu, les taux
+/// d'ombrage de l'image suivante sont calculés à partir de cette image.
+/// En présentation asynchrone, l'image est copiée dans un framebuffer libre
+/// et mise en attente de présentation : appelée par le thread de rendu
+/// (voir Renderer_RenderFrame()), la fonction n'utilise pas le moteur de rendu
+/// SDL ; appelée directement, elle présente elle-même l'image.
+/// @param[in,out] renderer le moteur de rendu.
+void Renderer_Update(Renderer *renderer);
+
+/// @ingroup Renderer
+/// @brief Calcule une image avec une fonction fournie par l'appelant et présente
+/// les images rendues. Doit être appelée par le thread ayant créé la fenêtre.
+/// En présentation synchrone, la fonction est simplement appelée.
+/// En présentation asynchrone, elle est exécutée par le thread de rendu pendant
+/// que le thread appelant présente l'image précédente (copie dans la texture et
+/// attente de la synchronisation verticale comprises) : l'image est affichée
+/// lors de l'appel suivant.
+/// Renderer_RenderFrame() ne rend la main qu'une fois l'image calculée : la scène
+/// et le moteur de rendu peuvent ensuite être modifiés sans synchronisation.
+/// @param[in,out] renderer le moteur de rendu.
+/// @param render la fonction calculant l'image, terminée par Renderer_Update().
+/// @param data les données transmises à la fonction.
+void Renderer_RenderFrame(Renderer *renderer, RendererFrameFunc *render, void *data);
+
+/// @ingroup Renderer
+/// @brief Définit le mode de présentation des images rendues.
+/// L'image en attente est présentée avant le changement de mode.
+/// En présentation asynchrone, un thread de rendu est créé ; le moteur de rendu
+/// SDL reste utilisé uniquement par le thread appelant.
+/// @param[in,out] renderer le moteur de rendu.
+/// @param mode le mode de présentation.
+/// @return EXIT_SUCCESS ou EXIT_FAILURE.
+int Renderer_SetPresentMode(Renderer *renderer, RendererPresentMode mode);
+
+/// @ingroup Renderer
+/// @brief Renvoie le mode de présentation des images rendues.
+/// @param[in] renderer le moteur de rendu.
+/// @return Le mode de présentation.
+INLINE RendererPresentMode Renderer_GetPresentMode(Renderer *renderer)
+{
+    return renderer->m_presentMode;
+}
+
+/// @ingroup Renderer
+/// @brief Définit si les pixels sont écrits directement dans la mémoire de la
+/// texture (SDL_LockTexture()), ce qui supprime la copie de l'image complète
+/// à chaque présentation.
+/// Le rendu direct n'est effectif qu'avec le rangement RENDERER_LAYOUT_LINEAR et
+/// la présentation synchrone, entre Renderer_BeginFrame() et Renderer_Update().
+/// Si le pas de la texture verrouillée diffère de celui des buffers, l'image est
+/// rendue puis copiée comme sans rendu direct.
+/// La mémoire de la texture n'est jamais relue : chaque image doit être
+/// entièrement redessinée (Renderer_Fill()).
+/// @param[in,out] renderer le moteur de rendu.
+/// @param zeroCopy true pour écrire directement dans la texture.
+void Renderer_SetZeroCopy(Renderer *renderer, bool zeroCopy);
+
+/// @ingroup Renderer
+/// @brief Renvoie un booléen indiquant si le rendu direct dans la texture est demandé.
+/// @param[in] renderer le moteur de rendu.
+/// @return true si le rendu direct est demandé.
+INLINE bool Renderer_GetZeroCopy(Renderer *renderer)
+{
+    return renderer->m_zeroCopy;
+}
+
+/// @ingroup Renderer
+/// @brief Renvoie les statistiques de présentation.
+/// @param[in] renderer le moteur de rendu.
+/// @return Les statistiques de présentation depuis la création du moteur de rendu.
+RendererPresentStats Renderer_GetPresentStats(Renderer *renderer);
+
+/// @ingroup Renderer
+/// @brief Copie la dernière image rendue dans un buffer fourni par l'appelant,
+/// ligne par ligne depuis le haut, quatre octets par pixel dans l'ordre R, G, B, A.
+/// Doit être appelée après Renderer_Update() et avant le rendu de l'image suivante,
+/// sans rendu direct dans la texture. À résolution réduite, l'image est agrandie.
+/// @param[in] renderer le moteur de rendu.
+/// @param[out] pixels le buffer de destination (au moins pitch x hauteur octets).
+/// @param pitch le nombre d'octets séparant deux lignes du buffer.
+void Renderer_ReadPixels(Renderer *renderer, Uint8 *pixels, int pitch);
+
+/// @ingroup Renderer
+/// @brief Enregistre la dernière image rendue au format PPM binaire (P6)
+/// (voir Renderer_ReadPixels()).
+/// @param[in] renderer le moteur de rendu.
+/// @param path le chemin du fichier.
+/// @return EXIT_SUCCESS ou EXIT_FAILURE.
+int Renderer_SavePPM(Renderer *renderer, const char *path);
+
+/// @ingroup Renderer
+/// @brief Enregistre la dernière image rendue au format PNG avec SDL_image
+/// (voir Renderer_ReadPixels()).
+/// @param[in] renderer le moteur de rendu.
+/// @param path le chemin du fichier.
+/// @return EXIT_SUCCESS ou EXIT_FAILURE.
+int Renderer_SavePNG(Renderer *renderer, const char *path);
@@ -1,216 +1,313 @@
-﻿#include "Scene.h"
-#include "Window.h"
-#include "Matrix.h"
-#include "Vector.h"
-#include "Object.h"
-#include "Graphics.h"
-#include "Shader.h"
-
-Scene *Scene_New(Window *window)
-{
-    Scene *scene = NULL;
-    int meshCapacity = 16;
-    int exitStatus;
-
-    scene = (Scene *)calloc(1, sizeof(Scene));
-    if (!scene) goto ERROR_LABEL;
-
-    scene->m_renderer = Window_getRenderer(window);
-
-    scene->m_meshes = (Mesh **)calloc(meshCapacity, sizeof(Mesh *));
-    if (!scene->m_meshes) goto ERROR_LABEL;
-
-    scene->m_meshCount = 0;
-    scene->m_meshCapacity = meshCapacity;
-
-
-    // Crée la racine
-    Object *root = Scene_CreateObject(scene, sizeof(Object));
-    if (!root) goto ERROR_LABEL;
-
-    exitStatus = Object_Init(root, scene, Mat4_Identity, NULL);
-    if (exitStatus != EXIT_SUCCESS) goto ERROR_LABEL;
-
-    scene->m_root = root;
-
-    // Crée la caméra
-    Mat4 camTransform = Mat4_GetTranslationMatrix(Vec3_Set(0.0f, 0.0f, 5.0f));
-    Camera *camera = (Camera *)Scene_CreateObject(scene, sizeof(Camera));
-    if (!camera) goto ERROR_LABEL;
-
-    exitStatus = Camera_Init(camera, scene, camTransform, root);
-    if (exitStatus != EXIT_SUCCESS) goto ERROR_LABEL;
-
-    scene->m_camera = camera;
-
-
-    scene->m_lights = (Light**) calloc(1, sizeof(Light*));
-
-    // Définit les lumières
-    Light *light = Light_Create();
-    Scene_AddLight(scene, light);
-    Scene_SetAmbiantColor(scene, Vec3_Set(0.12f, 0.14f, 0.24f));
-
-    // Définit les shaders par défaut
-    scene->m_defaultVShader = VertexShader_Base;
-    scene->m_defaultFShader = FragmentShader_Base;
-
-    return scene;
-
-ERROR_LABEL:
-    printf("ERROR - Scene_new()\n");
-    assert(false);
-    Scene_Free(scene);
-    return NULL;
-}
-
-void Scene_Free(Scene *scene)
-{
-    if (!scene) return;
-
-    // Supprime l'ensemble des objets
-    Scene_RemoveObject(scene, scene->m_root);
-
-    // Supprime les meshes
-    int meshCount = scene->m_meshCount;
-    for (int i = 0; i < meshCount; ++i)
-    {
-        Mesh_Free(scene->m_meshes[i]);
-    }
-    free(scene->m_meshes);
-
-    // Met à zéro la mémoire (sécurité)
-    memset(scene, 0, sizeof(Scene));
-
-    free(scene);
-}
-
-Object *Scene_CreateObject(Scene *scene, int size)
-{
-    Object *object = NULL;
-
-    assert(size >= sizeof(Object));
-
-    object = (Object *)calloc(1, size);
-    if (!object) goto ERROR_LABEL;
-
-    return object;
-
-ERROR_LABEL:
-    printf("ERROR - Scene_CreateObject()\n");
-    assert(false);
-    return NULL;
-}
-
-void Scene_RemoveObject(Scene *scene, Object *object)
-{
-    assert(scene && object);
-
-    while (Object_GetChildCount(object) > 0)
-    {
-        Object *child = Object_GetFirstChild(object);
-        Scene_RemoveObject(scene, child);
-    }
-
-    Object_Destroy(object);
-    free(object);
-}
-
-static int Scene_EnsureMeshCapacity(Scene *scene, int meshCount)
-{
-    int meshCapacity = scene->m_meshCapacity;
-    if (meshCapacity >= meshCount)
-    {
-        return EXIT_SUCCESS;
-    }
-
-    meshCapacity = Int_Max(meshCapacity << 1, meshCount + 1);
-    Mesh **newMeshes = (Mesh **)realloc(scene->m_meshes, meshCapacity * sizeof(Mesh *));
-    if (!newMeshes) goto ERROR_LABEL;
-
-    scene->m_meshes = newMeshes;
-    scene->m_meshCapacity = meshCapacity;
-
-    return EXIT_SUCCESS;
-
-ERROR_LABEL:
-    printf("ERROR - Scene_EnsureMeshCapacity()\n");
-    assert(false);
-    return EXIT_FAILURE;
-}
-
-Mesh *Scene_CreateMeshFromOBJ(Scene *scene, char *folderPath, char *fileName)
-{
-    Mesh *mesh = NULL;
-    int meshCount = scene->m_meshCount;
-    int meshCapacity = scene->m_meshCapacity;
-
-    int exitStatus = Scene_EnsureMeshCapacity(scene, meshCount + 1);
-    if (exitStatus != EXIT_SUCCESS) goto ERROR_LABEL;
-
-    mesh = Mesh_LoadOBJ(folderPath, fileName);
-    if (!mesh) goto ERROR_LABEL;
-
-    exitStatus = Mesh_ComputeTangents(mesh);
-    if (exitStatus != EXIT_SUCCESS) goto ERROR_LABEL;
-
-    scene->m_meshes[meshCount] = mesh;
-    scene->m_meshCount = meshCount + 1;
-
-    return mesh;
-
-ERROR_LABEL:
-    printf("ERROR - Scene_CreateMeshFromOBJ()\n");
-    assert(false);
-    return NULL;
-}
-
-Object *Scene_GetRoot(Scene *scene)
-{
-    return scene->m_root;
-}
-
-Camera *Scene_GetCamera(Scene *scene)
-{
-    return scene->m_camera;
-}
-
-
-void Scene_RenderObjectRec(Scene *scene, Object *object)
-{
-    int childCount = Object_GetChildCount(object);
-    Object **children = Object_GetChildren(object);
-    for (int i = 0; i < childCount; ++i)
-    {
-        Scene_RenderObjectRec(scene, children[i]);
-    }
-
-    Renderer *renderer = scene->m_renderer;
-    VertexShader *vertShader = scene->m_defaultVShader;
-    FragmentShader *fragShader = scene->m_defaultFShader;
-
-    Graphics_RenderObject(renderer, object, vertShader, fragShader);
-}
-
-void Scene_Render(Scene *scene)
-{
-    Vec4 backgroundColor = Vec4_Set(0.08f, 0.08f, 0.12f, 1.0f);
-
-    Renderer_ResetDepthBuffer(scene->m_renderer);
-    Renderer_Fill(scene->m_renderer, backgroundColor);
-    Scene_RenderObjectRec(scene, Scene_GetRoot(scene));
-}
-
-void Scene_AddLight(Scene *scene, Light *light) {
-    scene->m_lighCount++;
-    scene->m_lights = realloc(scene->m_lights, scene->m_lighCount * sizeof(scene->m_lights));
-    scene->m_lights[scene->m_lighCount-1] = light;
-    printf("Light added - total %d\n", scene->m_lighCount);
-}
-
-void Scene_FreeLights(Scene *scene) {
-    for (int i = 0; i < scene->m_lighCount; ++i) {
-        Light_Free(scene->m_lights[i]);
-    }
-    free(scene->m_lights);
+#include "Scene.h"
+#include "Window.h"
+#include "Matrix.h"
+#include "Vector.h"
+#include "Object.h"
+#include "Graphics.h"
+#include "Shader.h"
+
+Scene *Scene_New(Window *window)
+{
+    return Scene_NewWithRenderer(Window_getRenderer(window));
+}
+
+Scene *Scene_NewWithRenderer(Renderer *renderer)
+{
+    Scene *scene = NULL;
+    int meshCapacity = 16;
+    int exitStatus;
+
+    scene = (Scene *)calloc(1, sizeof(Scene));
+    if (!scene) goto ERROR_LABEL;
+
+    scene->m_renderer = renderer;
+
+    scene->m_meshes = (Mesh **)calloc(meshCapacity, sizeof(Mesh *));
+    if (!scene->m_meshes) goto ERROR_LABEL;
+
+    scene->m_meshCount = 0;
+    scene->m_meshCapacity = meshCapacity;
+
+
+    // Crée la racine
+    Object *root = Scene_CreateObject(scene, sizeof(Object));
+    if (!root) goto ERROR_LABEL;
+
+    exitStatus = Object_Init(root, scene, Mat4_Identity, NULL);
+    if (exitStatus != EXIT_SUCCESS) goto ERROR_LABEL;
+
+    scene->m_root = root;
+
+    // Crée la caméra
+    Mat4 camTransform = Mat4_GetTranslationMatrix(Vec3_Set(0.0f, 0.0f, 5.0f));
+    Camera *camera = (Camera *)Scene_CreateObject(scene, sizeof(Camera));
+    if (!camera) goto ERROR_LABEL;
+
+    exitStatus = Camera_Init(camera, scene, camTransform, root);
+    if (exitStatus != EXIT_SUCCESS) goto ERROR_LABEL;
+
+    scene->m_camera = camera;
+
+
+    scene->m_lights = (Light**) calloc(1, sizeof(Light*));
+
+    // Définit les lumières
+    Light *light = Light_Create();
+    Scene_AddLight(scene, light);
+    Scene_SetAmbiantColor(scene, Vec3_Set(0.12f, 0.14f, 0.24f));
+
+    // Définit les shaders par défaut
+    scene->m_defaultVShader = VertexShader_Base;
+    scene->m_defaultFShader = FragmentShader_Base;
+    scene->m_defaultFShaderLateZ = false;
+
+    return scene;
+
+ERROR_LABEL:
+    printf("ERROR - Scene_new()\n");
+    assert(false);
+    Scene_Free(scene);
+    return NULL;
+}
+
+void Scene_Free(Scene *scene)
+{
+    if (!scene) return;
+
+    // Supprime l'ensemble des objets
+    Scene_RemoveObject(scene, scene->m_root);
+
+    // Supprime les meshes
+    int meshCount = scene->m_meshCount;
+    for (int i = 0; i < meshCount; ++i)
+    {
+        Mesh_Free(scene->m_meshes[i]);
+    }
+    free(scene->m_meshes);
+
+    // Met à zéro la mémoire (sécurité)
+    memset(scene, 0, sizeof(Scene));
+
+    free(scene);
+}
+
+Object *Scene_CreateObject(Scene *scene, int size)
+{
+    Object *object = NULL;
+
+    assert(size >= sizeof(Object));
+
+    object = (Object *)calloc(1, size);
+    if (!object) goto ERROR_LABEL;
+
+    return object;
+
+ERROR_LABEL:
+    printf("ERROR - Scene_CreateObject()\n");
+    assert(false);
+    return NULL;
+}
+
+void Scene_RemoveObject(Scene *scene, Object *object)
+{
+    assert(scene && object);
+
+    while (Object_GetChildCount(object) > 0)
+    {
+        Object *child = Object_GetFirstChild(object);
+        Scene_RemoveObject(scene, child);
+    }
+
+    Object_Destroy(object);
+    free(object);
+}
+
+static int Scene_EnsureMeshCapacity(Scene *scene, int meshCount)
+{
+    int meshCapacity = scene->m_meshCapacity;
+    if (meshCapacity >= meshCount)
+    {
+        return EXIT_SUCCESS;
+    }
+
+    meshCapacity = Int_Max(meshCapacity << 1, meshCount + 1);
+    Mesh **newMeshes = (Mesh **)realloc(scene->m_meshes, meshCapacity * sizeof(Mesh *));
+    if (!newMeshes) goto ERROR_LABEL;
+
+    scene->m_meshes = newMeshes;
+    scene->m_meshCapacity = meshCapacity;
+
+    return EXIT_SUCCESS;
+
+ERROR_LABEL:
+    printf("ERROR - Scene_EnsureMeshCapacity()\n");
+    assert(false);
+    return EXIT_FAILURE;
+}
+
+Mesh *Scene_CreateMeshFromOBJ(Scene *scene, char *folderPath, char *fileName)
+{
+    Mesh *mesh = NULL;
+    int meshCount = scene->m_meshCount;
+    int meshCapacity = scene->m_meshCapacity;
+
+    int exitStatus = Scene_EnsureMeshCapacity(scene, meshCount + 1);
+    if (exitStatus != EXIT_SUCCESS) goto ERROR_LABEL;
+
+    mesh = Mesh_LoadOBJ(folderPath, fileName);
+    if (!mesh) goto ERROR_LABEL;
+
+    exitStatus = Mesh_ComputeTangents(mesh);
+    if (exitStatus != EXIT_SUCCESS) goto ERROR_LABEL;
+
+    exitStatus = Mesh_ComputeCorners(mesh);
+    if (exitStatus != EXIT_SUCCESS) goto ERROR_LABEL;
+
+    printf("Mesh %s : %d triangles, %d unique vertices, reuse = %.2f\n",
+        fileName, mesh->m_triangleCount, mesh->m_cornerCount, Mesh_GetVertexReuse(mesh));
+
+    scene->m_meshes[meshCount] = mesh;
+    scene->m_meshCount = meshCount + 1;
+
+    return mesh;
+
+ERROR_LABEL:
+    printf("ERROR - Scene_CreateMeshFromOBJ()\n");
+    assert(false);
+    return NULL;
+}
+
+Object *Scene_GetRoot(Scene *scene)
+{
+    return scene->m_root;
+}
+
+Camera *Scene_GetCamera(Scene *scene)
+{
+    return scene->m_camera;
+}
+
+
+void Scene_RenderObjectRec(Scene *scene, Object *object, GraphicsView *views, int viewCount)
+{
+    int childCount = Object_GetChildCount(object);
+    Object **children = Object_GetChildren(object);
+    for (int i = 0; i < childCount; ++i)
+    {
+        Scene_RenderObjectRec(scene, children[i], views, viewCount);
+    }
+
+    Renderer *renderer = scene->m_renderer;
+    VertexShader *vertShader = scene->m_defaultVShader;
+    FragmentShader *fragShader = scene->m_defaultFShader;
+    bool lateZ = scene->m_defaultFShaderLateZ;
+
+    Graphics_RenderObjectViews(renderer, object, views, viewCount, vertShader, fragShader, lateZ);
+}
+
+void Scene_Render(Scene *scene)
+{
+    GraphicsView view = { 0 };
+    view.camera = scene->m_camera;
+    view.viewport = Renderer_GetViewport(scene->m_renderer);
+
+    Scene_RenderViews(scene, &view, 1);
+}
+
+void Scene_RenderViews(Scene *scene, GraphicsView *views, int viewCount)
+{
+    Vec4 backgroundColor = Vec4_Set(0.08f, 0.08f, 0.12f, 1.0f);
+
+    Renderer_BeginFrame(scene->m_renderer);
+    Renderer_ResetStats(scene->m_renderer);
+    Renderer_ResetDepthBuffer(scene->m_renderer);
+    Renderer_Fill(scene->m_renderer, backgroundColor);
+    Scene_RenderObjectRec(scene, Scene_GetRoot(scene), views, viewCount);
+}
+
+int Scene_SetDepthFormat(Scene *scene, RendererDepthFormat format, GraphicsView *views, int viewCount)
+{
+    assert(views || viewCount == 0);
+    Camera *camera = scene->m_camera;
+    bool reversedZ = (format == RENDERER_DEPTH_FLOAT_REVERSED);
+
+    int exitStatus = Renderer_SetDepthFormat(scene->m_renderer, format);
+    if (exitStatus != EXIT_SUCCESS) goto ERROR_LABEL;
+
+    Camera_SetDepthRange(camera, reversedZ, Camera_GetInfiniteFar(camera));
+
+    // Les caméras des vues sont vérifiées au rendu (voir Graphics_RenderObjectViews())
+    for (int v = 0; v < viewCount; ++v)
+    {
+        camera = views[v].camera;
+        Camera_SetDepthRange(camera, reversedZ, Camera_GetInfiniteFar(camera));
+    }
+
+    return EXIT_SUCCESS;
+
+ERROR_LABEL:
+    printf("ERROR - Scene_SetDepthFormat()\n");
+    assert(false);
+    return EXIT_FAILURE;
+}
+
+int Scene_BenchmarkLayouts(Scene *scene, int frameCount)
+{
+    static const char *layoutNames[RENDERER_LAYOUT_COUNT] = { "linear", "tiled", "morton" };
+    const int resetCount = 100;
+
+    Renderer *renderer = scene->m_renderer;
+    RendererLayout currLayout = Renderer_GetLayout(renderer);
+    double frequency = (double)SDL_GetPerformanceFrequency();
+
+    for (int i = 0; i < RENDERER_LAYOUT_COUNT; ++i)
+    {
+        int exitStatus = Renderer_SetLayout(renderer, (RendererLayout)i);
+        if (exitStatus != EXIT_SUCCESS) goto ERROR_LABEL;
+
+        // Réinitialisation du buffer de profondeur seule, effectuée immédiatement
+        // sur toutes les tuiles (elle est sinon différée jusqu'au rendu des tuiles)
+        Uint64 start = SDL_GetPerformanceCounter();
+        for (int j = 0; j < resetCount; ++j)
+        {
+            Renderer_ResetDepthBuffer(renderer);
+            Renderer_PrepareAllTiles(renderer);
+        }
+        double resetTime = (double)(SDL_GetPerformanceCounter() - start) / frequency / resetCount;
+
+        // Rendu complet de la scène (sans la copie dans la texture)
+        long long fragments = 0;
+        start = SDL_GetPerformanceCounter();
+        for (int j = 0; j < frameCount; ++j)
+        {
+            Scene_Render(scene);
+            fragments += Renderer_GetStats(renderer).fragmentsShaded;
+        }
+        double renderTime = (double)(SDL_GetPerformanceCounter() - start) / frequency;
+
+        printf("Layout %-6s : reset depth = %.3f ms, render = %.2f ms, %.1f Mfragments/s\n",
+            layoutNames[i], 1000.0 * resetTime, 1000.0 * renderTime / frameCount,
+            (double)fragments / renderTime * 1e-6);
+    }
+
+    return Renderer_SetLayout(renderer, currLayout);
+
+ERROR_LABEL:
+    printf("ERROR - Scene_BenchmarkLayouts()\n");
+    assert(false);
+    return EXIT_FAILURE;
+}
+
+void Scene_AddLight(Scene *scene, Light *light) {
+    scene->m_lighCount++;
+    scene->m_lights = realloc(scene->m_lights, scene->m_lighCount * sizeof(scene->m_lights));
+    scene->m_lights[scene->m_lighCount-1] = light;
+    printf("Light added - total %d\n", scene->m_lighCount);
+}
+
+void Scene_FreeLights(Scene *scene) {
+    for (int i = 0; i < scene->m_lighCount; ++i) {
+        Light_Free(scene->m_lights[i]);
+    }
+    free(scene->m_lights);
 }
\ No newline at end of file
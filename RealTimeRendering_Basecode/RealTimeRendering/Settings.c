@@ -1,27 +1,46 @@
-#include "Settings.h"
-
-int Settings_InitSDL()
-{
-    // Initialise la SDL2
-    int flags = SDL_INIT_VIDEO;
-    if (SDL_Init(flags) < 0)
-    {
-        printf("ERROR - SDL_Init %s\n", SDL_GetError());
-        return EXIT_FAILURE;
-    }
-
-    // Initialise la SDL2 image
-    flags = IMG_INIT_PNG | IMG_INIT_JPG;
-    if (IMG_Init(flags) != flags)
-    {
-        printf("ERROR - IMG_Init %s\n", IMG_GetError());
-    }
-
-    return EXIT_SUCCESS;
-}
-
-void Settings_QuitSDL()
-{
-    IMG_Quit();
-    SDL_Quit();
+#include "Settings.h"
+
+int Settings_InitSDL()
+{
+    // Initialise la SDL2
+    int flags = SDL_INIT_VIDEO;
+    if (SDL_Init(flags) < 0)
+    {
+        printf("ERROR - SDL_Init %s\n", SDL_GetError());
+        return EXIT_FAILURE;
+    }
+
+    // Initialise la SDL2 image
+    flags = IMG_INIT_PNG | IMG_INIT_JPG;
+    if (IMG_Init(flags) != flags)
+    {
+        printf("ERROR - IMG_Init %s\n", IMG_GetError());
+    }
+
+    return EXIT_SUCCESS;
+}
+
+int Settings_InitSDLHeadless()
+{
+    // Initialise la SDL2 sans fenêtre (timers uniquement)
+    if (SDL_Init(SDL_INIT_TIMER) < 0)
+    {
+        printf("ERROR - SDL_Init %s\n", SDL_GetError());
+        return EXIT_FAILURE;
+    }
+
+    // Initialise la SDL2 image (enregistrement PNG)
+    int flags = IMG_INIT_PNG;
+    if (IMG_Init(flags) != flags)
+    {
+        printf("ERROR - IMG_Init %s\n", IMG_GetError());
+    }
+
+    return EXIT_SUCCESS;
+}
+
+void Settings_QuitSDL()
+{
+    IMG_Quit();
+    SDL_Quit();
 }
\ No newline at end of file
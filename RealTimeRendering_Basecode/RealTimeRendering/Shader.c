@@ -5,27 +5,27 @@
 
 VShaderOut VertexShader_Base(VShaderIn *in, VShaderGlobals *globals)
 {
-    // Le vertex shader est une fonction excute pour chacun des sommets
-    // d'un objet  rendre.
-    // Il rcupre des donnes globales  l'objet comme les matrices de conversion.
+    // Le vertex shader est une fonction exécutée pour chacun des sommets
+    // d'un objet à rendre.
+    // Il récupère des données globales à l'objet comme les matrices de conversion.
     // Il se charge principalement de projeter le sommet dans le "clip space"
-    // et de convertir la normale/tangente associe dans le rfrentiel monde.
-    // Le vertex shader est excut pour chacun des sommets d'un objet  rendre.
+    // et de convertir la normale/tangente associée dans le référentiel monde.
+    // Le vertex shader est exécuté pour chacun des sommets d'un objet à rendre.
     VShaderOut out = { 0 };
     
-    // Coordonnes homognes du sommet (w = 1 car c'est un point)
+    // Coordonnées homogènes du sommet (w = 1 car c'est un point)
     Vec4 vertex = Vec4_From3(in->vertex, 1.0f);
 
-    // Coordonnes homognes de la normale (w = 0 car c'est une direction)
+    // Coordonnées homogènes de la normale (w = 0 car c'est une direction)
     Vec4 normal = Vec4_From3(in->normal, 0.0f);
 
-    // Coordonnes homognes de la tangente (w = 0 car c'est une direction)
+    // Coordonnées homogènes de la tangente (w = 0 car c'est une direction)
     Vec4 tangent = Vec4_From3(in->tangent, 0.0f);
 
-    // Coordonnes homognes de la bitangente (w = 0 car c'est une direction)
+    // Coordonnées homogènes de la bitangente (w = 0 car c'est une direction)
     Vec4 bitangent = Vec4_From3(in->bitangent, 0.0f);
 
-    // Transformation du sommet dans le repre camra
+    // Transformation du sommet dans le repère caméra
     Vec4 vertexCamSpace = Mat4_MulMV(globals->objToView, vertex);
 
     // Projection du sommet dans le "clip space"
@@ -34,21 +34,22 @@ VShaderOut VertexShader_Base(VShaderIn *in, VShaderGlobals *globals)
     // Calcul de la bitangente
     in->bitangent = Vec3_Cross(in->tangent, in->normal);
 
-    // Transformation de la normale dans le repre monde
+    // Transformation de la normale dans le repère monde
     normal = Mat4_MulMV(globals->objToWorld, normal);
 
-    // Transformation de la tangente dans le repre monde
+    // Transformation de la tangente dans le repère monde
     tangent = Mat4_MulMV(globals->objToWorld, tangent);
 
-    // Transformation de la bitangente dans le repre monde
+    // Transformation de la bitangente dans le repère monde
     bitangent = Mat4_MulMV(globals->objToWorld, bitangent);
 
 
-    // Obtention de la position du sommet  partir de la normale
+    // Obtention de la position du sommet à partir de la normale
     Vec3 worldPos = Vec3_From4(Mat4_MulMV(globals->objToWorld, vertex));
 
-    // Dfinit la sortie du vertex shader
+    // Définit la sortie du vertex shader
     out.clipPos = Vec3_From4(vertexClipSpace);  // OBLIGATOIRE (ne pas modifier)
+    out.clipPosH = vertexClipSpace;
     out.invDepth = vertexCamSpace.w / vertexCamSpace.z; // OBLIGATOIRE (ne pas modifier)
     out.normal = Vec3_Normalize(Vec3_From4(normal));
     out.textUV = in->textUV;
@@ -61,48 +62,50 @@ VShaderOut VertexShader_Base(VShaderIn *in, VShaderGlobals *globals)
 
 Vec4 FragmentShader_Base(FShaderIn *in, FShaderGlobals *globals)
 {
-    // Le fragment shader est une fonction excute pour chaque pixel
+    // Le fragment shader est une fonction exécutée pour chaque pixel
     // de tous les triangles visibles.
-    // Il rcupre un fragment qui contient des donnes interpoles
+    // Il récupère un fragment qui contient des données interpolées
     // (position, normale, tangente, uv).
     // Il retourne la couleur du pixel.
     //
-    // Le vecteur (x,y,z,w) renvoy par le fragment shader est interprt comme suit :
-    // - x : intensit du rouge (entre 0 et 1)
-    // - y : intensit du vert  (entre 0 et 1)
-    // - z : intensit du bleu  (entre 0 et 1)
-    // - w : opacit            (entre 0 et 1)
+    // Le vecteur (x,y,z,w) renvoyé par le fragment shader est interprété comme suit :
+    // - x : intensité du rouge (entre 0 et 1)
+    // - y : intensité du vert  (entre 0 et 1)
+    // - z : intensité du bleu  (entre 0 et 1)
+    // - w : opacité            (entre 0 et 1)
 
-    // Rcupration du matriau associ au pixel (albedo/normal map/roughness map)
+    // Récupération du matériau associé au pixel (albedo/normal map/roughness map)
     Material *material = globals->material;
     assert(material);
 
-    // Rcupration de la texture (albedo) associe au pixel
+    // Récupération de la texture (albedo) associée au pixel
     MeshTexture *albedoTex = Material_GetAlbedo(material);
     assert(albedoTex);
 
-    // Rcupration de la texture (normalMap) associe au pixel
+    // Récupération de la texture (normalMap) associée au pixel
     MeshTexture *normalTex = Material_GetNormalMap(material);
 
-    // Rcupration des coordonnes (u,v) associe au pixel.
-    // Les coordonnes (u,v) sont dans [0,1]^2.
-    // - u reprsente l'abscisse du point sur une texture 2D.
-    // - v reprsente l'ordonne du point sur une texture 2D.
-    // (0,0) reprsente le coin en bas  gauche.
-    // (1,1) reprsente le coin en haut  droite.
+    // Récupération des coordonnées (u,v) associée au pixel.
+    // Les coordonnées (u,v) sont dans [0,1]^2.
+    // - u représente l'abscisse du point sur une texture 2D.
+    // - v représente l'ordonnée du point sur une texture 2D.
+    // (0,0) représente le coin en bas à gauche.
+    // (1,1) représente le coin en haut à droite.
     float u = in->textUV.x;
     float v = in->textUV.y;
 
-    // Recupration de la couleur du pixel dans la texture
-    Vec3 albedo = MeshTexture_GetColorVec3(albedoTex, Vec2_Set(u, v));
+    // Recupération de la couleur du pixel dans la texture
+    Vec3 albedo = MeshTexture_GetColorVec3Lod(
+        albedoTex, Vec2_Set(u, v), in->ddxTextUV, in->ddyTextUV);
 
 
-    // Rcupration de la duret (roughness) associe au pixel
+    // Récupération de la dureté (roughness) associée au pixel
     MeshTexture *roughnessTex = Material_GetRoughness(material);
 
     if (roughnessTex && Scene_GetRoughness(globals->scene)) {
-        // Recupration de la valeur du pixel dans la roughnessMap
-        Vec3 roughness = MeshTexture_GetColorVec3(roughnessTex, Vec2_Set(u, v));
+        // Recupération de la valeur du pixel dans la roughnessMap
+        Vec3 roughness = MeshTexture_GetColorVec3Lod(
+            roughnessTex, Vec2_Set(u, v), in->ddxTextUV, in->ddyTextUV);
         in->gloss = 1-roughness.x;
     }
     else in->gloss = 0.5;
@@ -113,22 +116,23 @@ Vec4 FragmentShader_Base(FShaderIn *in, FShaderGlobals *globals)
             in->tangent.y, in->bitangent.y, in->normal.y,
             in->tangent.z, in->bitangent.z, in->normal.z,
         };
-        Vec3 normalMap = MeshTexture_GetColorVec3(normalTex, Vec2_Set(u, v));
+        Vec3 normalMap = MeshTexture_GetColorVec3Lod(
+            normalTex, Vec2_Set(u, v), in->ddxTextUV, in->ddyTextUV);
 
         in->normal = Mat3_MulMV(matrixTBN, normalMap);
     }
 
-    // Rcupre les lumires de la scne
+    // Récupère les lumières de la scène
     Light **lights = Scene_GetLights(globals->scene);
     Vec3 lightColor = Light_GetLightColor(lights[0]);
     Vec3 ambiant = Scene_GetAmbiantColor(globals->scene);
 
 
-    // Application de la lumire ambiante  l'albedo
+    // Application de la lumière ambiante à l'albedo
     albedo = Vec3_Mul(albedo, ambiant);
 
 
-    // Application des lumires diffuse/spculaires
+    // Application des lumières diffuse/spéculaires
     float lightCoef = 0;
     for (int i = 0; i < globals->scene->m_lighCount; ++i) {
         lightCoef += CalculateLightingCoefficient(lights[i], in, globals->cameraPos);
@@ -139,21 +143,21 @@ Vec4 FragmentShader_Base(FShaderIn *in, FShaderGlobals *globals)
 
 
     // TODO
-    // Pour la lumire spculaire de Blinn-Phong, il faut :
-    // - rcuprer l'interpolation de la position dans le monde du pixel ;
-    // - calculer le vecteur de vue, le vecteur moiti
+    // Pour la lumière spéculaire de Blinn-Phong, il faut :
+    // - récupérer l'interpolation de la position dans le monde du pixel ;
+    // - calculer le vecteur de vue, le vecteur moitié
     // Vous devez donc modifier le vertex shader, puis modifier la fonction
-    // Graphics_RenderTriangle() pour initialiser l'interpolation puis pour
-    // calculer l'interpolation.
-    // Utilisez les macros VEC3_INIT_INTERPOLATION() et VEC3_INTERPOLATE().
+    // Graphics_SetupTriangle() pour calculer les équations de plan (VShaderPlanes)
+    // puis Graphics_RasterizeTriangle() pour calculer l'interpolation.
+    // Utilisez les macros VEC3_SETUP_PLANES() et VEC3_EVAL_PLANES().
 
     //.............................................................................................
-    // Quelques exemples de debug ( dcommenter)
+    // Quelques exemples de debug (à décommenter)
     
     // Debug : couleur unique en RGBA (bleu ESIEA)
     //return Vec4_Set(0.21f, 0.66f, 0.88f, 1.0f);
     
-    // Debug : coordonnes (uv) de texture
+    // Debug : coordonnées (uv) de texture
     //return Vec4_From2(in->textUV, 0.0, 1.0f);
 
     // Debug : normales
@@ -166,6 +170,6 @@ Vec4 FragmentShader_Base(FShaderIn *in, FShaderGlobals *globals)
     // return Vec4_From3(Vec3_Scale(Vec3_Set(1, 1, 1), in->gloss), 1.0f);
     //.............................................................................................
 
-    // Retourne la couleur (albedo) associe au pixel dans la texture.
+    // Retourne la couleur (albedo) associée au pixel dans la texture.
     return Vec4_From3(albedo, 1.0f);
 }
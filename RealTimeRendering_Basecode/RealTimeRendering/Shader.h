@@ -1,118 +1,143 @@
-#pragma once
-
-#include "Settings.h"
-#include "Vector.h"
-#include "Matrix.h"
-#include "Mesh.h"
-#include "Material.h"
-
-typedef struct Scene_s Scene;
-
-/// @brief Structure reprsentant les donnes globales fournies au vertex shader.
-typedef struct VShaderGlobals_s
-{
-    Vec3 cameraPos;
-    Mat4 objToWorld;
-    Mat4 viewToWorld;
-    Mat4 objToView;
-    Mat4 objToClip;
-} VShaderGlobals;
-
-/// @brief Structure reprsentant les donnes d'un sommet fournies au vertex shader.
-typedef struct VShaderIn_s
-{
-    /// @brief Position du sommet dans le rfrentiel objet.
-    Vec3 vertex;
-
-    /// @brief Position de la normale associe au sommet dans le rfrentiel objet.
-    Vec3 normal;
-
-    /// @brief Position de la tangente associe au sommet dans le rfrentiel objet.
-    Vec3 tangent;
-
-    /// @brief Position de la bitangente associe au sommet dans le rfrentiel objet.
-    Vec3 bitangent;
-
-    /// @brief Coordonnes uv associes au sommet.
-    Vec2 textUV;
-} VShaderIn;
-
-/// @brief Structure reprsentant la sortie du vertex shader
-typedef struct VShaderOut_s
-{
-    /// @brief Position du sommet aprs la projection en perspective.
-    /// Les coordonnes des points visibles sont entre -1.0f et 1.0f (sur chaque axe).
-    Vec3  clipPos;
-
-    /// @brief Inverse de la coordonne z du sommet dans le rfrentiel camra.
-    float invDepth;
-
-    /// @brief Normale associe au sommet exprime dans le rfrentiel monde.
-    Vec3  normal;
-
-    /// @brief Coordonnes uv associes au sommet.
-    Vec2  textUV;
-
-    // TODO
-    // Pour les bonus
-
-    /// @brief Position du sommet dans le rfrentiel monde.
-    Vec3  worldPos;
-
-    /// @brief Tangente associe au sommet exprime dans le rfrentiel monde.
-    Vec3  tangent;
-
-    /// @brief Bitangente associe au sommet exprime dans le rfrentiel monde.
-    Vec3  bitangent;
-
-} VShaderOut;
-
-/// @brief Structure reprsentant les donnes globales fournies au fragment shader.
-typedef struct FShaderGlobals_s
-{
-    /// @brief Pointeur vers la scne.
-    Scene *scene;
-
-    /// @brief Matriau utilis pour le triangle.
-    Material *material;
-
-    /// @brief Position de la camra.
-    Vec3 cameraPos;
-} FShaderGlobals;
-
-/// @brief Structure reprsentant les donnes associe  un pixel (fragment)
-/// fournies au fragment shader.
-/// Elle sont obtenues par interpolation des sorties du vertex shader.
-typedef struct FShaderIn_s
-{
-    /// @brief Normale associe au pixel exprime dans le rfrentiel monde.
-    /// Le vecteur est obtenu par interpolation, donc n'est pas ncessairement unitaire.
-    Vec3 normal;
-
-    /// @brief Coordonnes uv associes au pixel.
-    Vec2 textUV;
-
-    // TODO
-    // Pour les bonus
-
-    /// @brief Position associe au pixel exprime dans le rfrentiel monde.
-    /// Ncessaire pour la lumire spculaire de Blinn-Phong
-    Vec3 worldPos;
-
-    float gloss;
-
-    /// @brief Tangente associe au pixel exprime dans le rfrentiel monde.
-    /// Ncessaire pour l'utilisation d'une "normal map".
-    /// Le vecteur est obtenu par interpolation, donc n'est pas ncessairement unitaire
-    /// ou perpendiculaire  la normale.
-    Vec3 tangent;
-
-    Vec3 bitangent;
-} FShaderIn;
-
-typedef VShaderOut VertexShader(VShaderIn *in, VShaderGlobals *globals);
-typedef Vec4     FragmentShader(FShaderIn *in, FShaderGlobals *globals);
-
-VShaderOut VertexShader_Base(VShaderIn *in, VShaderGlobals *globals);
-
-Vec4 FragmentShader_Base(FShaderIn *in, FShaderGlobals *globals);
+#pragma once
+
+#include "Settings.h"
+#include "Vector.h"
+#include "Matrix.h"
+#include "Mesh.h"
+#include "Material.h"
+#include "Raster.h"
+
+typedef struct Scene_s Scene;
+
+/// @brief Structure représentant les données globales fournies au vertex shader.
+typedef struct VShaderGlobals_s
+{
+    Vec3 cameraPos;
+    Mat4 objToWorld;
+    Mat4 viewToWorld;
+    Mat4 objToView;
+    Mat4 objToClip;
+} VShaderGlobals;
+
+/// @brief Structure représentant les données d'un sommet fournies au vertex shader.
+typedef struct VShaderIn_s
+{
+    /// @brief Position du sommet dans le référentiel objet.
+    Vec3 vertex;
+
+    /// @brief Position de la normale associée au sommet dans le référentiel objet.
+    Vec3 normal;
+
+    /// @brief Position de la tangente associée au sommet dans le référentiel objet.
+    Vec3 tangent;
+
+    /// @brief Position de la bitangente associée au sommet dans le référentiel objet.
+    Vec3 bitangent;
+
+    /// @brief Coordonnées uv associées au sommet.
+    Vec2 textUV;
+} VShaderIn;
+
+/// @brief Structure représentant la sortie du vertex shader
+typedef struct VShaderOut_s
+{
+    /// @brief Position du sommet après la projection en perspective.
+    /// Les coordonnées des points visibles sont entre -1.0f et 1.0f (sur chaque axe).
+    Vec3  clipPos;
+
+    /// @brief Coordonnées homogènes du sommet après la projection (avant la division par w).
+    /// Utilisées pour le découpage des triangles par les plans du frustum.
+    Vec4  clipPosH;
+
+    /// @brief Inverse de la coordonnée z du sommet dans le référentiel caméra.
+    float invDepth;
+
+    /// @brief Normale associée au sommet exprimée dans le référentiel monde.
+    Vec3  normal;
+
+    /// @brief Coordonnées uv associées au sommet.
+    Vec2  textUV;
+
+    // TODO
+    // Pour les bonus
+
+    /// @brief Position du sommet dans le référentiel monde.
+    Vec3  worldPos;
+
+    /// @brief Tangente associée au sommet exprimée dans le référentiel monde.
+    Vec3  tangent;
+
+    /// @brief Bitangente associée au sommet exprimée dans le référentiel monde.
+    Vec3  bitangent;
+
+} VShaderOut;
+
+/// @brief Structure représentant les sorties du vertex shader d'un triangle sous
+/// forme d'équations de plan dans le repère raster.
+/// Pour une interpolation correcte en perspective, chaque attribut est multiplié
+/// par invDepth avant le calcul de son plan : la valeur d'un attribut en un pixel
+/// est le rapport entre le plan de l'attribut et le plan de invDepth.
+typedef struct VShaderPlanes_s
+{
+    RasterPlane invDepth;
+    RasterPlane normal[3];
+    RasterPlane textUV[2];
+    RasterPlane worldPos[3];
+    RasterPlane tangent[3];
+} VShaderPlanes;
+
+/// @brief Structure représentant les données globales fournies au fragment shader.
+typedef struct FShaderGlobals_s
+{
+    /// @brief Pointeur vers la scène.
+    Scene *scene;
+
+    /// @brief Matériau utilisé pour le triangle.
+    Material *material;
+
+    /// @brief Position de la caméra.
+    Vec3 cameraPos;
+} FShaderGlobals;
+
+/// @brief Structure représentant les données associée à un pixel (fragment)
+/// fournies au fragment shader.
+/// Elle sont obtenues par interpolation des sorties du vertex shader.
+typedef struct FShaderIn_s
+{
+    /// @brief Normale associée au pixel exprimée dans le référentiel monde.
+    /// Le vecteur est obtenu par interpolation, donc n'est pas nécessairement unitaire.
+    Vec3 normal;
+
+    /// @brief Coordonnées uv associées au pixel.
+    Vec2 textUV;
+
+    /// @brief Dérivées des coordonnées uv selon x et selon y (en uv par pixel).
+    /// Elles sont obtenues par différences entre les pixels d'un même quad 2x2
+    /// et permettent de choisir le niveau de mipmap d'une texture.
+    Vec2 ddxTextUV;
+    Vec2 ddyTextUV;
+
+    // TODO
+    // Pour les bonus
+
+    /// @brief Position associée au pixel exprimée dans le référentiel monde.
+    /// Nécessaire pour la lumière spéculaire de Blinn-Phong
+    Vec3 worldPos;
+
+    float gloss;
+
+    /// @brief Tangente associée au pixel exprimée dans le référentiel monde.
+    /// Nécessaire pour l'utilisation d'une "normal map".
+    /// Le vecteur est obtenu par interpolation, donc n'est pas nécessairement unitaire
+    /// ou perpendiculaire à la normale.
+    Vec3 tangent;
+
+    Vec3 bitangent;
+} FShaderIn;
+
+typedef VShaderOut VertexShader(VShaderIn *in, VShaderGlobals *globals);
+typedef Vec4     FragmentShader(FShaderIn *in, FShaderGlobals *globals);
+
+VShaderOut VertexShader_Base(VShaderIn *in, VShaderGlobals *globals);
+
+Vec4 FragmentShader_Base(FShaderIn *in, FShaderGlobals *globals);
@@ -0,0 +1,158 @@
+#include "TileBins.h"
+#include "Tools.h"
+
+TileBins *TileBins_New(int width, int height)
+{
+    TileBins *bins = NULL;
+
+    bins = (TileBins *)calloc(1, sizeof(TileBins));
+    if (!bins) goto ERROR_LABEL;
+
+    bins->m_tileCountX = (width + TILE_SIZE - 1) / TILE_SIZE;
+    bins->m_tileCountY = (height + TILE_SIZE - 1) / TILE_SIZE;
+
+    int tileCount = TileBins_GetTileCount(bins);
+    bins->m_bins = (TileBin *)calloc(tileCount, sizeof(TileBin));
+    if (!bins->m_bins) goto ERROR_LABEL;
+
+    return bins;
+
+ERROR_LABEL:
+    printf("ERROR - TileBins_New()\n");
+    assert(false);
+    TileBins_Free(bins);
+    return NULL;
+}
+
+void TileBins_Free(TileBins *bins)
+{
+    if (!bins) return;
+
+    if (bins->m_bins)
+    {
+        int tileCount = TileBins_GetTileCount(bins);
+        for (int i = 0; i < tileCount; ++i)
+        {
+            free(bins->m_bins[i].m_indices);
+        }
+        free(bins->m_bins);
+    }
+    free(bins->m_vertices);
+    free(bins->m_triangles);
+
+    // Met à zéro la mémoire (sécurité)
+    memset(bins, 0, sizeof(TileBins));
+
+    free(bins);
+}
+
+static int TileBins_Reserve(TileBins *bins, int triangleCount)
+{
+    if (triangleCount > bins->m_triangleCapacity)
+    {
+        int capacity = Int_Max(bins->m_triangleCapacity << 1, triangleCount);
+        BinnedTriangle *newTriangles = (BinnedTriangle *)realloc(
+            bins->m_triangles, capacity * sizeof(BinnedTriangle));
+        if (!newTriangles) return EXIT_FAILURE;
+
+        bins->m_triangles = newTriangles;
+        bins->m_triangleCapacity = capacity;
+    }
+
+    return EXIT_SUCCESS;
+}
+
+int TileBins_Reset(TileBins *bins, int vertexCount, int triangleCount)
+{
+    if (vertexCount > bins->m_vertexCapacity)
+    {
+        int capacity = Int_Max(bins->m_vertexCapacity << 1, vertexCount);
+        VShaderOut *newVertices = (VShaderOut *)realloc(
+            bins->m_vertices, capacity * sizeof(VShaderOut));
+        if (!newVertices) goto ERROR_LABEL;
+
+        bins->m_vertices = newVertices;
+        bins->m_vertexCapacity = capacity;
+    }
+
+    int tileCount = TileBins_GetTileCount(bins);
+    for (int i = 0; i < tileCount; ++i)
+    {
+        bins->m_bins[i].m_count = 0;
+    }
+
+    int exitStatus = TileBins_Reserve(bins, triangleCount);
+    if (exitStatus != EXIT_SUCCESS) goto ERROR_LABEL;
+
+    bins->m_triangleCount = triangleCount;
+
+    return EXIT_SUCCESS;
+
+ERROR_LABEL:
+    printf("ERROR - TileBins_Reset()\n");
+    assert(false);
+    return EXIT_FAILURE;
+}
+
+int TileBins_NewTriangle(TileBins *bins)
+{
+    int exitStatus = TileBins_Reserve(bins, bins->m_triangleCount + 1);
+    if (exitStatus != EXIT_SUCCESS) goto ERROR_LABEL;
+
+    return bins->m_triangleCount++;
+
+ERROR_LABEL:
+    printf("ERROR - TileBins_NewTriangle()\n");
+    assert(false);
+    return -1;
+}
+
+static int TileBin_Push(TileBin *bin, int triangleIndex)
+{
+    if (bin->m_count >= bin->m_capacity)
+    {
+        int capacity = Int_Max(bin->m_capacity << 1, 64);
+        int *newIndices = (int *)realloc(bin->m_indices, capacity * sizeof(int));
+        if (!newIndices) goto ERROR_LABEL;
+
+        bin->m_indices = newIndices;
+        bin->m_capacity = capacity;
+    }
+
+    bin->m_indices[bin->m_count++] = triangleIndex;
+
+    return EXIT_SUCCESS;
+
+ERROR_LABEL:
+    printf("ERROR - TileBin_Push()\n");
+    assert(false);
+    return EXIT_FAILURE;
+}
+
+int TileBins_Add(TileBins *bins, int triangleIndex)
+{
+    RasterTriangle *raster = &(bins->m_triangles[triangleIndex].raster);
+
+    return TileBins_AddRect(
+        bins, triangleIndex, raster->xmin, raster->ymin, raster->xmax, raster->ymax);
+}
+
+int TileBins_AddRect(TileBins *bins, int triangleIndex, int xmin, int ymin, int xmax, int ymax)
+{
+    int tx0 = xmin / TILE_SIZE;
+    int tx1 = xmax / TILE_SIZE;
+    int ty0 = ymin / TILE_SIZE;
+    int ty1 = ymax / TILE_SIZE;
+
+    for (int ty = ty0; ty <= ty1; ++ty)
+    {
+        for (int tx = tx0; tx <= tx1; ++tx)
+        {
+            TileBin *bin = bins->m_bins + ty * bins->m_tileCountX + tx;
+            int exitStatus = TileBin_Push(bin, triangleIndex);
+            if (exitStatus != EXIT_SUCCESS) return EXIT_FAILURE;
+        }
+    }
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,135 @@
+#pragma once
+
+/// @file TileBins.h
+/// @defgroup TileBins
+/// @{
+
+#include "Settings.h"
+#include "Shader.h"
+#include "Raster.h"
+
+/// @brief Taille en pixels (largeur et hauteur) d'une tuile de l'écran.
+#define TILE_SIZE 64
+
+/// @brief Structure représentant un triangle après l'étape de géométrie
+/// (vertex shader, projection et préparation de la rastérisation).
+typedef struct BinnedTriangle_s
+{
+    /// @brief Sorties du vertex shader (utilisées pour le découpage).
+    VShaderOut vertices[3];
+
+    /// @brief Equations des arêtes et boîte englobante du triangle.
+    /// En fil de fer sans test de profondeur, seule la boîte englobante est utilisée.
+    RasterTriangle raster;
+
+    /// @brief Equations de plan des sorties du vertex shader.
+    VShaderPlanes planes;
+
+    /// @brief Matériau utilisé pour le triangle.
+    Material *material;
+
+    /// @brief Plans (bits de GraphicsClipPlane) par lesquels le triangle doit être
+    /// découpé avant sa rastérisation, ou 0 si aucun découpage n'est nécessaire.
+    int clipPlanes;
+
+    /// @brief Arêtes dessinées en fil de fer : le bit i correspond à l'arête allant
+    /// du sommet i au sommet (i + 1) % 3. Les arêtes internes à l'éventail
+    /// d'un triangle découpé ne sont pas dessinées.
+    unsigned edgeMask;
+
+    /// @brief Indique si le triangle doit être rastérisé.
+    bool visible;
+} BinnedTriangle;
+
+/// @brief Liste des triangles recouvrant une tuile.
+typedef struct TileBin_s
+{
+    int *m_indices;
+    int  m_count;
+    int  m_capacity;
+} TileBin;
+
+/// @brief Structure représentant le découpage de l'écran en tuiles.
+/// Les triangles d'un objet sont d'abord transformés puis répartis dans
+/// les tuiles qu'ils recouvrent. Chaque tuile est ensuite rastérisée
+/// par un seul thread : un pixel n'a donc qu'un seul écrivain.
+typedef struct TileBins_s
+{
+    /// @brief Nombre de tuiles en largeur.
+    int m_tileCountX;
+
+    /// @brief Nombre de tuiles en hauteur.
+    int m_tileCountY;
+
+    /// @brief Tableau des tuiles (ligne par ligne).
+    TileBin *m_bins;
+
+    /// @brief Sorties du vertex shader pour chaque sommet unique de l'objet en cours de rendu.
+    VShaderOut *m_vertices;
+
+    /// @brief Nombre maximal de sommets avant une réallocation.
+    int m_vertexCapacity;
+
+    /// @brief Tableau des triangles transformés de l'objet en cours de rendu.
+    BinnedTriangle *m_triangles;
+
+    /// @brief Nombre de triangles du tableau m_triangles.
+    int m_triangleCount;
+
+    /// @brief Nombre maximal de triangles avant une réallocation.
+    int m_triangleCapacity;
+} TileBins;
+
+/// @brief Crée le découpage en tuiles d'une zone de rendu.
+/// @param width la largeur en pixels de la zone de rendu.
+/// @param height la hauteur en pixels de la zone de rendu.
+/// @return Les tuiles créées ou NULL en cas d'erreur.
+TileBins *TileBins_New(int width, int height);
+
+/// @brief Détruit un découpage en tuiles préalablement alloué avec TileBins_New().
+/// @param bins les tuiles à détruire.
+void TileBins_Free(TileBins *bins);
+
+/// @brief Vide toutes les tuiles et garantit la place pour un nombre de sommets
+/// et de triangles donné.
+/// @param[in,out] bins les tuiles.
+/// @param vertexCount le nombre de sommets uniques à transformer.
+/// @param triangleCount le nombre de triangles à assembler.
+/// @return EXIT_SUCCESS ou EXIT_FAILURE.
+int TileBins_Reset(TileBins *bins, int vertexCount, int triangleCount);
+
+/// @brief Ajoute un triangle à la fin du tableau m_triangles.
+/// Utilisé pour les triangles issus du découpage d'un triangle de l'objet.
+/// Attention, le tableau peut être réalloué : les pointeurs vers ses éléments
+/// ne sont plus valides après l'appel.
+/// @param[in,out] bins les tuiles.
+/// @return L'indice du nouveau triangle ou -1 en cas d'erreur.
+int TileBins_NewTriangle(TileBins *bins);
+
+/// @brief Ajoute un triangle transformé dans toutes les tuiles recouvertes
+/// par sa boîte englobante.
+/// Les triangles doivent être ajoutés dans l'ordre de soumission pour que
+/// le rendu reste déterministe.
+/// @param[in,out] bins les tuiles.
+/// @param triangleIndex l'indice du triangle dans le tableau m_triangles.
+/// @return EXIT_SUCCESS ou EXIT_FAILURE.
+int TileBins_Add(TileBins *bins, int triangleIndex);
+
+/// @brief Ajoute un triangle transformé dans toutes les tuiles recouvertes
+/// par un rectangle de l'écran (bornes incluses), par exemple la boîte englobante
+/// de ses arêtes en fil de fer (voir TileBins_Add()).
+/// @param[in,out] bins les tuiles.
+/// @param triangleIndex l'indice du triangle dans le tableau m_triangles.
+/// @param xmin, ymin, xmax, ymax le rectangle, contenu dans la zone de rendu.
+/// @return EXIT_SUCCESS ou EXIT_FAILURE.
+int TileBins_AddRect(TileBins *bins, int triangleIndex, int xmin, int ymin, int xmax, int ymax);
+
+/// @brief Renvoie le nombre total de tuiles.
+/// @param[in] bins les tuiles.
+/// @return Le nombre de tuiles.
+INLINE int TileBins_GetTileCount(TileBins *bins)
+{
+    return bins->m_tileCountX * bins->m_tileCountY;
+}
+
+/// @}
@@ -1,4 +1,4 @@
-﻿#include "Settings.h"
+#include "Settings.h"
 #include "Window.h"
 #include "Camera.h"
 #include "Matrix.h"
@@ -11,6 +11,17 @@
 #include "Mesh.h"
 #include "Material.h"
 
+/// @brief Calcule le rendu de la scène puis met à jour le rendu
+/// (voir Renderer_RenderFrame()).
+/// @param data la scène.
+static void Main_RenderFrame(void *data)
+{
+    Scene *scene = (Scene *)data;
+
+    Scene_Render(scene);
+    Renderer_Update(scene->m_renderer);
+}
+
 int main(int argc, char *argv[])
 {
     Window *window = NULL;
@@ -27,6 +38,10 @@ int main(int argc, char *argv[])
 
     renderer = Window_getRenderer(window);
 
+    // Calcule les images sur un thread dédié pendant la présentation (double buffering)
+    exitStatus = Renderer_SetPresentMode(renderer, RENDERER_PRESENT_ASYNC);
+    if (exitStatus != EXIT_SUCCESS) goto ERROR_LABEL;
+
     g_time = Timer_New();
     if (!g_time) goto ERROR_LABEL;
 
@@ -124,6 +139,13 @@ int main(int argc, char *argv[])
                     lightY += evt.motion.yrel * 0.01;
                     lightXZ += evt.motion.xrel * 0.01;
                 }
+                // La zone ombrée en pleine résolution suit la souris
+                if (Renderer_GetShadingMode(renderer) == RENDERER_SHADING_FOVEATED) {
+                    int windowWidth, windowHeight;
+                    SDL_GetWindowSize(window->m_windowSDL, &windowWidth, &windowHeight);
+                    Renderer_SetFoveation(renderer, Vec2_Set(
+                        (float)evt.motion.x / windowWidth, (float)evt.motion.y / windowHeight), 0.25f);
+                }
                 break;
             case SDL_QUIT:
                 quit = true;
@@ -146,6 +168,10 @@ int main(int argc, char *argv[])
                 case SDL_SCANCODE_SPACE:
                     Scene_SetWireframe(scene, !Scene_GetWireframe(scene));
                     break;
+                case SDL_SCANCODE_W:
+                    Scene_SetWireframeDepthTest(scene, !Scene_GetWireframeDepthTest(scene));
+                    printf("Wireframe depth test : %d\n", Scene_GetWireframeDepthTest(scene));
+                    break;
                 case SDL_SCANCODE_L:
                     Light_CycleLightType(light);
                     break;
@@ -157,6 +183,75 @@ int main(int argc, char *argv[])
                     Scene_SetNormal(scene, !Scene_GetNormal(scene));
                     printf("Normal : %d\n", Scene_GetNormal(scene));
                     break;
+                case SDL_SCANCODE_Z:
+                    Scene_SetFragmentShaderLateZ(scene, !Scene_GetFragmentShaderLateZ(scene));
+                    printf("Late Z : %d\n", Scene_GetFragmentShaderLateZ(scene));
+                    break;
+                case SDL_SCANCODE_H:
+                    Renderer_SetHierarchical(renderer, !Renderer_GetHierarchical(renderer));
+                    printf("Hierarchical : %d\n", Renderer_GetHierarchical(renderer));
+                    break;
+                case SDL_SCANCODE_M:
+                    exitStatus = Renderer_SetSampleCount(renderer,
+                        (Renderer_GetSampleCount(renderer) > 1) ? 1 : RASTER_MSAA_SAMPLES);
+                    if (exitStatus != EXIT_SUCCESS) goto ERROR_LABEL;
+                    printf("MSAA : %dx\n", Renderer_GetSampleCount(renderer));
+                    break;
+                case SDL_SCANCODE_T:
+                    exitStatus = Renderer_SetLayout(renderer,
+                        (Renderer_GetLayout(renderer) + 1) % RENDERER_LAYOUT_COUNT);
+                    if (exitStatus != EXIT_SUCCESS) goto ERROR_LABEL;
+                    printf("Layout : %d\n", Renderer_GetLayout(renderer));
+                    break;
+                case SDL_SCANCODE_D:
+                    exitStatus = Scene_SetDepthFormat(scene,
+                        (Renderer_GetDepthFormat(renderer) + 1) % RENDERER_DEPTH_FORMAT_COUNT, NULL, 0);
+                    if (exitStatus != EXIT_SUCCESS) goto ERROR_LABEL;
+                    printf("Depth format : %d\n", Renderer_GetDepthFormat(renderer));
+                    break;
+                case SDL_SCANCODE_F:
+                    Camera_SetDepthRange(camera,
+                        Camera_GetReversedZ(camera), !Camera_GetInfiniteFar(camera));
+                    printf("Infinite far : %d\n", Camera_GetInfiniteFar(camera));
+                    break;
+                case SDL_SCANCODE_P:
+                    exitStatus = Renderer_SetPresentMode(renderer,
+                        (Renderer_GetPresentMode(renderer) + 1) % RENDERER_PRESENT_MODE_COUNT);
+                    if (exitStatus != EXIT_SUCCESS) goto ERROR_LABEL;
+                    printf("Present mode : %d\n", Renderer_GetPresentMode(renderer));
+                    break;
+                case SDL_SCANCODE_C:
+                    Renderer_SetZeroCopy(renderer, !Renderer_GetZeroCopy(renderer));
+                    printf("Zero-copy : %d\n", Renderer_GetZeroCopy(renderer));
+                    break;
+                case SDL_SCANCODE_G:
+                    exitStatus = Renderer_SetHdr(renderer, !Renderer_GetHdr(renderer));
+                    if (exitStatus != EXIT_SUCCESS) goto ERROR_LABEL;
+                    printf("HDR : %d\n", Renderer_GetHdr(renderer));
+                    break;
+                case SDL_SCANCODE_A:
+                    exitStatus = Renderer_SetWriteMode(renderer,
+                        (Renderer_GetWriteMode(renderer) + 1) % RENDERER_WRITE_MODE_COUNT);
+                    if (exitStatus != EXIT_SUCCESS) goto ERROR_LABEL;
+                    printf("Write mode : %d\n", Renderer_GetWriteMode(renderer));
+                    break;
+                case SDL_SCANCODE_S:
+                    // Résolution dynamique pour 60 images par seconde
+                    exitStatus = Renderer_SetDynamicResolution(renderer,
+                        (Renderer_GetTargetFrameTime(renderer) > 0.0f) ? 0.0f : 1.0f / 60.0f);
+                    if (exitStatus != EXIT_SUCCESS) goto ERROR_LABEL;
+                    printf("Dynamic resolution : %d\n", Renderer_GetTargetFrameTime(renderer) > 0.0f);
+                    break;
+                case SDL_SCANCODE_V:
+                    exitStatus = Renderer_SetShadingMode(renderer,
+                        (Renderer_GetShadingMode(renderer) + 1) % RENDERER_SHADING_MODE_COUNT);
+                    if (exitStatus != EXIT_SUCCESS) goto ERROR_LABEL;
+                    printf("Shading mode : %d\n", Renderer_GetShadingMode(renderer));
+                    break;
+                case SDL_SCANCODE_B:
+                    exitStatus = Scene_BenchmarkLayouts(scene, 20);
+                    if (exitStatus != EXIT_SUCCESS) goto ERROR_LABEL;
+                    break;
                 default:
                     break;
                 }
@@ -195,11 +290,8 @@ int main(int argc, char *argv[])
         // Applique la matrice locale de la caméra
         Object_SetTransform(((Object *)camera), Scene_GetRoot(scene), cameraModel);
 
-        // Calcule le rendu de la scène dans un buffer
-        Scene_Render(scene);
-
-        // Met à jour le rendu (affiche le buffer précédent)
-        Renderer_Update(renderer);
+        // Calcule le rendu de la scène dans un buffer et affiche le buffer précédent
+        Renderer_RenderFrame(renderer, Main_RenderFrame, scene);
 
         // Calcule les FPS
         fpsAccu += Timer_GetDelta(g_time);
@@ -207,6 +299,56 @@ int main(int argc, char *argv[])
         if (fpsAccu > 1.0f)
         {
             printf("FPS = %.1f\n", (float)frameCount / fpsAccu);
+            printf("Resolution scale : %.2f, frame time = %.2f ms\n",
+                Renderer_GetResolutionScale(renderer), 1000.0f * Renderer_GetFrameTime(renderer));
+
+            // Statistiques de la dernière image
+            RendererStats stats = Renderer_GetStats(renderer);
+            printf("Vertices : shaded = %lld, projected = %lld\n",
+                stats.verticesShaded, stats.verticesProjected);
+            printf("Triangles : culled = %lld, clipped = %lld\n",
+                stats.trianglesCulled, stats.trianglesClipped);
+            printf("Small triangles : rasterized = %lld, empty = %lld\n",
+                stats.trianglesSmall, stats.trianglesEmpty);
+            printf("Triangle sizes (pixels) : <1 = %lld", stats.triangleSizes[0]);
+            for (int i = 1; i < RENDERER_SIZE_BINS; ++i)
+            {
+                printf(", %s%d = %lld",
+                    (i < RENDERER_SIZE_BINS - 1) ? "<" : ">=",
+                    1 << (2 * ((i < RENDERER_SIZE_BINS - 1) ? i : i - 1)),
+                    stats.triangleSizes[i]);
+            }
+            printf("\n");
+            printf("Fragments : shaded = %lld, early-Z rejected = %lld\n",
+                stats.fragmentsShaded, stats.fragmentsCulled);
+            if (Renderer_GetShadingMode(renderer) != RENDERER_SHADING_FULL)
+            {
+                printf("Variable rate shading : invocations = %lld, saved = %lld\n",
+                    stats.fragmentsShaded - stats.shadingInvocationsSaved,
+                    stats.shadingInvocationsSaved);
+            }
+            if (Renderer_GetHierarchical(renderer))
+            {
+                printf("Blocks %dx%d : rejected = %lld, covered = %lld, partial = %lld\n",
+                    RASTER_BLOCK_SIZE, RASTER_BLOCK_SIZE,
+                    stats.blocksRejected, stats.blocksAccepted, stats.blocksPartial);
+                printf("Hi-Z : triangles occluded = %lld, blocks occluded = %lld\n",
+                    stats.trianglesOccluded, stats.blocksOccluded);
+            }
+            if (Renderer_GetWriteMode(renderer) != RENDERER_WRITE_TILED)
+            {
+                printf("Atomic : writes = %lld, retries = %lld\n",
+                    stats.atomicWrites, stats.atomicRetries);
+            }
+
+            // Statistiques de présentation depuis le lancement
+            RendererPresentStats presentStats = Renderer_GetPresentStats(renderer);
+            printf("Present : rendered = %lld, presented = %lld, present time = %.1f ms, "
+                "stalled = %lld (%.1f ms)\n",
+                presentStats.framesRendered, presentStats.framesPresented,
+                1000.0 * presentStats.presentTime, presentStats.framesStalled,
+                1000.0 * presentStats.stallTime);
+
             fpsAccu = 0.0f;
             frameCount = 0;
         }